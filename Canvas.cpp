@@ -0,0 +1,231 @@
+#include "Canvas.h"
+#include <string.h>
+
+Canvas::Canvas(uint16_t *pixels, int w, int h)
+{
+    buffer = pixels;
+    canvasWidth = w;
+    canvasHeight = h;
+    cursorX = 0;
+    cursorY = 0;
+    textSize = 1;
+}
+
+uint16_t Canvas::readPixel(int x, int y)
+{
+    if (x < 0 || y < 0 || x >= canvasWidth || y >= canvasHeight)
+        return 0;
+    return buffer[y * canvasWidth + x];
+}
+
+void Canvas::clear(uint32_t color)
+{
+    fillRect(0, 0, canvasWidth, canvasHeight, color);
+}
+
+void Canvas::drawFastHLine(int x, int y, int w, uint16_t color)
+{
+    if (y < 0 || y >= canvasHeight)
+        return;
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (x + w > canvasWidth)
+        w = canvasWidth - x;
+
+    uint16_t *row = buffer + y * canvasWidth + x;
+    for (int i = 0; i < w; i++)
+        row[i] = color;
+}
+
+void Canvas::fillRect(int x, int y, int w, int h, uint32_t color)
+{
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (y + h > canvasHeight)
+        h = canvasHeight - y;
+
+    for (int row = y; row < y + h; row++)
+        drawFastHLine(x, row, w, color);
+}
+
+// Same midpoint walk as TFT_eSPI::fillCircle
+void Canvas::fillCircle(int x0, int y0, int r, uint32_t color)
+{
+    int x = 0;
+    int dx = 1;
+    int dy = r + r;
+    int p = -(r >> 1);
+
+    drawFastHLine(x0 - r, y0, dy + 1, color);
+
+    while (x < r)
+    {
+        if (p >= 0)
+        {
+            drawFastHLine(x0 - x, y0 + r, 2 * x + 1, color);
+            drawFastHLine(x0 - x, y0 - r, 2 * x + 1, color);
+            dy -= 2;
+            p -= dy;
+            r--;
+        }
+
+        dx += 2;
+        p += dx;
+        x++;
+
+        drawFastHLine(x0 - r, y0 + x, 2 * r + 1, color);
+        drawFastHLine(x0 - r, y0 - x, 2 * r + 1, color);
+    }
+}
+
+// Same two-region walk as TFT_eSPI::fillEllipse
+void Canvas::fillEllipse(int x0, int y0, int rx, int ry, uint32_t color)
+{
+    if (rx < 2 || ry < 2)
+        return;
+
+    int rx2 = rx * rx;
+    int ry2 = ry * ry;
+    int fx2 = 4 * rx2;
+    int fy2 = 4 * ry2;
+    int x, y, s;
+
+    for (x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++)
+    {
+        drawFastHLine(x0 - x, y0 - y, x + x + 1, color);
+        drawFastHLine(x0 - x, y0 + y, x + x + 1, color);
+
+        if (s >= 0)
+        {
+            s += fx2 * (1 - y);
+            y--;
+        }
+        s += ry2 * ((4 * x) + 6);
+    }
+
+    for (x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++)
+    {
+        drawFastHLine(x0 - x, y0 - y, x + x + 1, color);
+        drawFastHLine(x0 - x, y0 + y, x + x + 1, color);
+
+        if (s >= 0)
+        {
+            s += fy2 * (1 - x);
+            x--;
+        }
+        s += rx2 * ((4 * y) + 6);
+    }
+}
+
+void Canvas::fillCircleHelper(int x0, int y0, int r, uint8_t corners, int delta, uint16_t color)
+{
+    int f = 1 - r;
+    int ddFx = 1;
+    int ddFy = -r - r;
+    int y = 0;
+
+    delta++;
+
+    while (y < r)
+    {
+        if (f >= 0)
+        {
+            if (corners & 0x1)
+                drawFastHLine(x0 - y, y0 + r, y + y + delta, color);
+            if (corners & 0x2)
+                drawFastHLine(x0 - y, y0 - r, y + y + delta, color);
+            r--;
+            ddFy += 2;
+            f += ddFy;
+        }
+
+        y++;
+        ddFx += 2;
+        f += ddFx;
+
+        if (corners & 0x1)
+            drawFastHLine(x0 - r, y0 + y, r + r + delta, color);
+        if (corners & 0x2)
+            drawFastHLine(x0 - r, y0 - y, r + r + delta, color);
+    }
+}
+
+void Canvas::fillRoundRect(int x, int y, int w, int h, int r, uint32_t color)
+{
+    fillRect(x, y + r, w, h - r - r, color);
+    fillCircleHelper(x + r, y + h - r - 1, r, 1, w - r - r - 1, color);
+    fillCircleHelper(x + r, y + r, r, 2, w - r - r - 1, color);
+}
+
+void Canvas::pushImage(int x, int y, int w, int h, const uint16_t *data)
+{
+    for (int row = 0; row < h; row++)
+    {
+        int dy = y + row;
+        if (dy < 0 || dy >= canvasHeight)
+            continue;
+
+        int start = x < 0 ? -x : 0;
+        int end = (x + w > canvasWidth) ? canvasWidth - x : w;
+        if (end > start)
+            memcpy(buffer + dy * canvasWidth + x + start, data + row * w + start, (end - start) * sizeof(uint16_t));
+    }
+}
+
+void Canvas::pushImage(int x, int y, int w, int h, const uint16_t *data, uint16_t transparent)
+{
+    for (int row = 0; row < h; row++)
+    {
+        int dy = y + row;
+        if (dy < 0 || dy >= canvasHeight)
+            continue;
+
+        for (int col = 0; col < w; col++)
+        {
+            int dx = x + col;
+            uint16_t color = data[row * w + col];
+            if (dx >= 0 && dx < canvasWidth && color != transparent)
+                buffer[dy * canvasWidth + dx] = color;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+// Text is only tracked, there is no font rasterizer on the canvas
+////////////////////////////////////////////////////////////////////
+void Canvas::setCursor(int x, int y)
+{
+    cursorX = x;
+    cursorY = y;
+}
+
+void Canvas::setTextColor(uint32_t color)
+{
+}
+
+void Canvas::setTextSize(int size)
+{
+    textSize = size;
+}
+
+void Canvas::print(const char *text)
+{
+    while (*text++)
+        cursorX += 6 * textSize;
+}
+
+void Canvas::println(const char *text)
+{
+    cursorX = 0;
+    cursorY += 8 * textSize;
+}
+
+void Canvas::drawString(const char *text, int x, int y, int font)
+{
+}
@@ -0,0 +1,163 @@
+#include "FrameBuffer.h"
+#include <string.h>
+
+// Glyph height of the built-in GLCD font, scaled by the text size
+static const int fontHeight = 8;
+
+FrameBuffer::FrameBuffer()
+{
+    targets[0] = NULL;
+    targets[1] = NULL;
+    pixels[0] = NULL;
+    pixels[1] = NULL;
+    back = NULL;
+    backIndex = 0;
+    pushRows = NULL;
+    waitForPush = NULL;
+    dirtyTop = 1;
+    dirtyBottom = 0;
+    cursorY = 0;
+    textSize = 1;
+}
+
+void FrameBuffer::begin(HalDisplay *targetA, uint16_t *pixelsA, HalDisplay *targetB, uint16_t *pixelsB,
+                        PushRows push, WaitForPush wait)
+{
+    targets[0] = targetA;
+    targets[1] = targetB;
+    pixels[0] = pixelsA;
+    pixels[1] = pixelsB;
+    backIndex = 0;
+    back = targets[backIndex];
+    pushRows = push;
+    waitForPush = wait;
+
+    // start from identical buffers
+    memcpy(pixels[1], pixels[0], back->width() * back->height() * sizeof(uint16_t));
+    dirtyTop = 1;
+    dirtyBottom = 0;
+}
+
+void FrameBuffer::markRows(int y, int h)
+{
+    int top = y < 0 ? 0 : y;
+    int bottom = y + h - 1;
+    if (bottom >= back->height())
+        bottom = back->height() - 1;
+    if (top > bottom)
+        return;
+
+    if (dirtyTop > dirtyBottom)
+    {
+        dirtyTop = top;
+        dirtyBottom = bottom;
+        return;
+    }
+    if (top < dirtyTop)
+        dirtyTop = top;
+    if (bottom > dirtyBottom)
+        dirtyBottom = bottom;
+}
+
+void FrameBuffer::present()
+{
+    if (dirtyTop > dirtyBottom)
+        return;
+
+    int w = back->width();
+    int y = dirtyTop;
+    int h = dirtyBottom - dirtyTop + 1;
+
+    // the buffer we are about to write into may still be the source of the last push
+    waitForPush();
+    pushRows(pixels[backIndex] + y * w, y, h);
+
+    // swap, then bring the new back buffer up to date while the push runs
+    backIndex ^= 1;
+    back = targets[backIndex];
+    memcpy(pixels[backIndex] + y * w, pixels[backIndex ^ 1] + y * w, h * w * sizeof(uint16_t));
+
+    dirtyTop = 1;
+    dirtyBottom = 0;
+}
+
+////////////////////////////////////////////////////////////////////
+// Drawing, forwarded to the back buffer with the rows recorded
+////////////////////////////////////////////////////////////////////
+void FrameBuffer::clear(uint32_t color)
+{
+    back->clear(color);
+    markRows(0, back->height());
+}
+
+void FrameBuffer::fillRect(int x, int y, int w, int h, uint32_t color)
+{
+    back->fillRect(x, y, w, h, color);
+    markRows(y, h);
+}
+
+void FrameBuffer::fillRoundRect(int x, int y, int w, int h, int r, uint32_t color)
+{
+    back->fillRoundRect(x, y, w, h, r, color);
+    markRows(y, h);
+}
+
+void FrameBuffer::fillCircle(int x, int y, int r, uint32_t color)
+{
+    back->fillCircle(x, y, r, color);
+    markRows(y - r, 2 * r + 1);
+}
+
+void FrameBuffer::fillEllipse(int x, int y, int rx, int ry, uint32_t color)
+{
+    back->fillEllipse(x, y, rx, ry, color);
+    markRows(y - ry, 2 * ry + 1);
+}
+
+void FrameBuffer::pushImage(int x, int y, int w, int h, const uint16_t *data)
+{
+    back->pushImage(x, y, w, h, data);
+    markRows(y, h);
+}
+
+void FrameBuffer::pushImage(int x, int y, int w, int h, const uint16_t *data, uint16_t transparent)
+{
+    back->pushImage(x, y, w, h, data, transparent);
+    markRows(y, h);
+}
+
+void FrameBuffer::setCursor(int x, int y)
+{
+    back->setCursor(x, y);
+    cursorY = y;
+}
+
+void FrameBuffer::setTextColor(uint32_t color)
+{
+    back->setTextColor(color);
+}
+
+void FrameBuffer::setTextSize(int size)
+{
+    back->setTextSize(size);
+    textSize = size;
+}
+
+void FrameBuffer::print(const char *text)
+{
+    back->print(text);
+    markRows(cursorY, fontHeight * textSize);
+}
+
+void FrameBuffer::println(const char *text)
+{
+    back->println(text);
+    markRows(cursorY, fontHeight * textSize);
+    cursorY += fontHeight * textSize;
+}
+
+void FrameBuffer::drawString(const char *text, int x, int y, int font)
+{
+    back->drawString(text, x, y, font);
+    markRows(y, fontHeight * textSize);
+}
@@ -0,0 +1,75 @@
+#include "FrameScheduler.h"
+
+unsigned long FrameScheduler::simOverruns = 0;
+unsigned long FrameScheduler::frameOverruns = 0;
+unsigned long FrameScheduler::idleMs = 0;
+
+unsigned long FrameScheduler::simPeriod = 100;
+unsigned long FrameScheduler::renderPeriod = FrameScheduler::defaultRenderPeriodMs;
+unsigned long FrameScheduler::nextSim = 0;
+unsigned long FrameScheduler::nextRender = 0;
+
+// Wrap-safe "a is at or after b" for millis() values
+static bool reached(unsigned long a, unsigned long b)
+{
+    return (long)(a - b) >= 0;
+}
+
+void FrameScheduler::start(unsigned long simPeriodMs, unsigned long renderPeriodMs)
+{
+    unsigned long now = millis();
+    simPeriod = simPeriodMs;
+    renderPeriod = renderPeriodMs;
+    nextSim = now + simPeriod;
+    nextRender = now + renderPeriod;
+    simOverruns = 0;
+    frameOverruns = 0;
+    idleMs = 0;
+}
+
+void FrameScheduler::resume(unsigned long sleptMs, unsigned long firstStepMs)
+{
+    unsigned long now = millis();
+    idleMs += sleptMs;
+    nextSim = now + firstStepMs;
+    nextRender = now;
+}
+
+bool FrameScheduler::simStepDue()
+{
+    unsigned long now = millis();
+    if (!reached(now, nextSim))
+        return false;
+
+    nextSim += simPeriod;
+    if (reached(now, nextSim))
+    {
+        // a whole period behind, drop the backlog
+        simOverruns++;
+        nextSim = now + simPeriod;
+    }
+    return true;
+}
+
+void FrameScheduler::waitForNextFrame()
+{
+    unsigned long now = millis();
+
+    // this frame's work is done, move on to the next render slot
+    if (reached(now, nextRender))
+    {
+        nextRender += renderPeriod;
+        if (reached(now, nextRender))
+        {
+            frameOverruns++;
+            nextRender = now + renderPeriod;
+        }
+    }
+
+    unsigned long deadline = reached(nextSim, nextRender) ? nextRender : nextSim;
+    if (!reached(now, deadline))
+    {
+        idleMs += deadline - now;
+        delay(deadline - now);
+    }
+}
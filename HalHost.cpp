@@ -0,0 +1,282 @@
+#ifndef ARDUINO
+
+#include "HalHost.h"
+#include "FrameBuffer.h"
+#include <math.h>
+#include <string.h>
+
+/////////////////////////////////////////////////////////////////////////////
+// Linux stub backend. The display is a software canvas so drawing costs real
+// CPU time, the sensors return whatever HalHost was last told to return.
+/////////////////////////////////////////////////////////////////////////////
+static const int hostScreenWidth = 320;
+static const int hostScreenHeight = 240;
+static uint16_t hostPixels[hostScreenWidth * hostScreenHeight];
+static Canvas hostScreen(hostPixels, hostScreenWidth, hostScreenHeight);
+
+static unsigned long virtualMillis = 0;
+
+float HalHost::accX = 0;
+float HalHost::accY = 0;
+float HalHost::accZ = 1;
+float HalHost::temperature = 22.0;
+float HalHost::humidity = 40.0;
+uint16_t HalHost::whiteLight = 0;
+uint16_t HalHost::ambientLight = 0;
+unsigned long HalHost::envReadMs = 9;
+unsigned long HalHost::envLowReadMs = 2;
+unsigned long HalHost::envLowReads = 0;
+unsigned long HalHost::lightReadMs = 0;
+unsigned long HalHost::imuReads = 0;
+unsigned long HalHost::envReads = 0;
+unsigned long HalHost::lightReads = 0;
+unsigned long HalHost::dingDongs = 0;
+int HalHost::scrollLines = 0;
+unsigned long HalHost::scrolls = 0;
+
+unsigned long millis()
+{
+    return virtualMillis;
+}
+
+void delay(unsigned long ms)
+{
+    virtualMillis += ms;
+}
+
+void HalHost::advanceMillis(unsigned long ms)
+{
+    virtualMillis += ms;
+}
+
+Canvas &HalHost::screen()
+{
+    return hostScreen;
+}
+
+class HostImu : public HalImu
+{
+    public:
+        void getAccelData(float *accX, float *accY, float *accZ) override
+        {
+            HalHost::imuReads++;
+            *accX = HalHost::accX;
+            *accY = HalHost::accY;
+            *accZ = HalHost::accZ;
+        }
+
+        // Samples "accumulate" at the FIFO rate of the virtual clock
+        int readAccelFifo(AccelSample *samples, int maxSamples) override
+        {
+            const unsigned long periodMs = 1000 / accelFifoRateHz;
+            unsigned long now = millis();
+            if (!primed)
+            {
+                lastSampleMs = now;
+                primed = true;
+            }
+            int count = 0;
+            while (count < maxSamples && now - lastSampleMs >= periodMs)
+            {
+                samples[count].x = (int16_t)(HalHost::accX * 1000);
+                samples[count].y = (int16_t)(HalHost::accY * 1000);
+                samples[count].z = (int16_t)(HalHost::accZ * 1000);
+                lastSampleMs += periodMs;
+                count++;
+            }
+            if (count > 0)
+                HalHost::imuReads++;
+            return count;
+        }
+
+    private:
+        bool primed = false;
+        unsigned long lastSampleMs = 0;
+};
+
+class HostEnvSensor : public HalEnvSensor
+{
+    public:
+        void getTempHumidity(float *temperature, float *humidity) override
+        {
+            // the SHT40 blocks for its whole conversion
+            HalHost::envReads++;
+            delay(HalHost::envReadMs);
+            *temperature = HalHost::temperature;
+            *humidity = HalHost::humidity;
+        }
+
+        void requestTempHumidity(EnvPrecision precision) override
+        {
+            pending = true;
+            readyAt = millis() + (precision == ENV_LOW_PRECISION ? HalHost::envLowReadMs : HalHost::envReadMs);
+            if (precision == ENV_LOW_PRECISION)
+                HalHost::envLowReads++;
+        }
+
+        bool readTempHumidity(float *temperature, float *humidity) override
+        {
+            if (!pending || millis() < readyAt)
+                return false;
+            pending = false;
+            HalHost::envReads++;
+            *temperature = HalHost::temperature;
+            *humidity = HalHost::humidity;
+            return true;
+        }
+
+    private:
+        bool pending = false;
+        unsigned long readyAt = 0;
+};
+
+class HostLightSensor : public HalLightSensor
+{
+    public:
+        uint16_t getWhiteLight() override
+        {
+            HalHost::lightReads++;
+            delay(HalHost::lightReadMs);
+            return HalHost::whiteLight;
+        }
+
+        void requestLight() override
+        {
+            pending = true;
+            readyAt = millis() + HalHost::lightReadMs;
+        }
+
+        bool readLight(uint16_t *whiteLight, uint16_t *ambientLight) override
+        {
+            if (!pending || millis() < readyAt)
+                return false;
+            pending = false;
+            HalHost::lightReads++;
+            *whiteLight = HalHost::whiteLight;
+            *ambientLight = HalHost::ambientLight;
+            return true;
+        }
+
+        void setAmbientAlert(uint16_t ambientThreshold) override
+        {
+            alertThreshold = ambientThreshold;
+        }
+
+        // Level-triggered, like the sensor re-flagging every integration
+        // period while the light stays up
+        bool ambientAlerted() override
+        {
+            return alertThreshold > 0 && HalHost::ambientLight > alertThreshold;
+        }
+
+    private:
+        bool pending = false;
+        unsigned long readyAt = 0;
+        uint16_t alertThreshold = 0;
+};
+
+class HostSpeaker : public HalSpeaker
+{
+    public:
+        void dingDong() override { HalHost::dingDongs++; }
+};
+
+static HostImu hostImu;
+static HostEnvSensor hostEnv;
+static HostLightSensor hostLight;
+static HostSpeaker hostSpeaker;
+
+HalDisplay *Hal::lcd = &hostScreen;
+HalImu *Hal::imu = &hostImu;
+HalEnvSensor *Hal::env = &hostEnv;
+HalLightSensor *Hal::light = &hostLight;
+HalSpeaker *Hal::spk = &hostSpeaker;
+
+#if MAZE_FRAMEBUFFER
+////////////////////////////////////////////////////////////////////
+// Framebuffer mode: two off-screen canvases, present() copies the
+// changed rows to the screen canvas the way the DMA push would
+////////////////////////////////////////////////////////////////////
+static uint16_t framePixelsA[hostScreenWidth * hostScreenHeight];
+static uint16_t framePixelsB[hostScreenWidth * hostScreenHeight];
+static Canvas frameA(framePixelsA, hostScreenWidth, hostScreenHeight);
+static Canvas frameB(framePixelsB, hostScreenWidth, hostScreenHeight);
+static FrameBuffer frameBuffer;
+
+static void pushFrameRows(const uint16_t *rows, int y, int h)
+{
+    memcpy(hostPixels + y * hostScreenWidth, rows, h * hostScreenWidth * sizeof(uint16_t));
+}
+
+static void waitForFrameRows()
+{
+}
+
+static int pendingScroll = -1;
+#endif
+
+void Hal::begin()
+{
+    virtualMillis = 0;
+
+#if MAZE_FRAMEBUFFER
+    frameBuffer.begin(&frameA, framePixelsA, &frameB, framePixelsB, pushFrameRows, waitForFrameRows);
+    Hal::lcd = &frameBuffer;
+#endif
+}
+
+void Hal::update()
+{
+}
+
+void Hal::serviceSensors()
+{
+}
+
+void Hal::setPowerProfile(PowerProfile profile)
+{
+}
+
+void Hal::holdFullSpeed(bool hold)
+{
+}
+
+// No touch panel, just let the virtual clock run
+bool Hal::sleepUntilTouch(unsigned long maxMs)
+{
+    delay(maxMs);
+    return true;
+}
+
+// The stub accelerometer only changes between loop() calls and has no
+// motion detector, so like a slow tilt on the Core2 nothing cuts the
+// sleep short
+bool Hal::sleepUntilMotion(unsigned long maxMs)
+{
+    delay(maxMs);
+    return true;
+}
+
+void Hal::present()
+{
+#if MAZE_FRAMEBUFFER
+    frameBuffer.present();
+    if (pendingScroll >= 0)
+    {
+        HalHost::scrollLines = pendingScroll;
+        pendingScroll = -1;
+    }
+#endif
+}
+
+void Hal::scrollVertically(int lines)
+{
+    HalHost::scrolls++;
+#if MAZE_FRAMEBUFFER
+    pendingScroll = lines;
+#else
+    HalHost::scrollLines = lines;
+#endif
+}
+
+#endif
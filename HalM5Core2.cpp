@@ -0,0 +1,792 @@
+#ifdef ARDUINO
+
+#include <M5Core2.h>
+#include <Adafruit_VCNL4040.h> // Sensor libraries
+#include "Adafruit_SHT4x.h"    // Sensor libraries
+#include "Hal.h"
+#include "I2C_RW.h"
+#include "SpscRing.h"
+#include "FrameBuffer.h"
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <esp_heap_caps.h>
+#include <driver/gpio.h>
+
+// GPIO the MPU6886 INT line is wired to, -1 when it isn't (the stock
+// Core2), in which case wake-on-motion is polled over I2C
+#ifndef MAZE_IMU_INT_PIN
+#define MAZE_IMU_INT_PIN -1
+#endif
+
+// Same for the VCNL4040 INT line (the Port A unit doesn't bring it out).
+// Only with it wired are light watches interrupt driven; without it the
+// latched flag register is polled, see Core2LightSensor::flagPollMs
+#ifndef MAZE_ALS_INT_PIN
+#define MAZE_ALS_INT_PIN -1
+#endif
+
+// Bus clocks: the VCNL4040 tops out at 400 kHz (the SHT40 alone could run
+// 1 MHz), and so do the MPU6886, FT6336U and AXP192 on the internal bus
+static const int portABusHz = 400000;
+static const uint32_t internalBusHz = 400000;
+
+// Initialize library objects (sensors and Time protocols)
+static Adafruit_VCNL4040 vcnl4040 = Adafruit_VCNL4040();
+static Adafruit_SHT4x sht4 = Adafruit_SHT4x();
+
+/////////////////////////////////////////////////////////////////////////////
+// M5Core2 backend: thin forwarding wrappers around the M5 and Adafruit
+// libraries. The display wrapper works on M5.Lcd and on TFT_eSprite frames,
+// both share the TFT_eSPI drawing API.
+/////////////////////////////////////////////////////////////////////////////
+
+// The panel has a native transparent blit
+static void pushTransparent(M5Display &gfx, int x, int y, int w, int h, const uint16_t *data, uint16_t transparent)
+{
+    gfx.pushImage(x, y, w, h, data, transparent);
+}
+
+// Sprites only take plain blits, so copy the opaque runs one by one
+static void pushTransparent(TFT_eSprite &gfx, int x, int y, int w, int h, const uint16_t *data, uint16_t transparent)
+{
+    for (int row = 0; row < h; row++)
+    {
+        const uint16_t *line = data + row * w;
+        int col = 0;
+        while (col < w)
+        {
+            while (col < w && line[col] == transparent)
+                col++;
+            int start = col;
+            while (col < w && line[col] != transparent)
+                col++;
+            if (col > start)
+                gfx.pushImage(x + start, y + row, col - start, 1, line + start);
+        }
+    }
+}
+
+template <class Gfx>
+class Core2Display : public HalDisplay
+{
+    public:
+        explicit Core2Display(Gfx &target) : gfx(target) {}
+
+        int width() override { return gfx.width(); }
+        int height() override { return gfx.height(); }
+        void startWrite() override { gfx.startWrite(); }
+        void endWrite() override { gfx.endWrite(); }
+        void clear(uint32_t color) override { gfx.fillScreen(color); }
+        void fillRect(int x, int y, int w, int h, uint32_t color) override { gfx.fillRect(x, y, w, h, color); }
+        void fillRoundRect(int x, int y, int w, int h, int r, uint32_t color) override { gfx.fillRoundRect(x, y, w, h, r, color); }
+        void fillCircle(int x, int y, int r, uint32_t color) override { gfx.fillCircle(x, y, r, color); }
+        void fillEllipse(int x, int y, int rx, int ry, uint32_t color) override { gfx.fillEllipse(x, y, rx, ry, color); }
+        void pushImage(int x, int y, int w, int h, const uint16_t *data) override { gfx.pushImage(x, y, w, h, data); }
+        void pushImage(int x, int y, int w, int h, const uint16_t *data, uint16_t transparent) override { pushTransparent(gfx, x, y, w, h, data, transparent); }
+        void setCursor(int x, int y) override { gfx.setCursor(x, y); }
+        void setTextColor(uint32_t color) override { gfx.setTextColor(color); }
+        void setTextSize(int size) override { gfx.setTextSize(size); }
+        void print(const char *text) override { gfx.print(text); }
+        void println(const char *text) override { gfx.println(text); }
+        void drawString(const char *text, int x, int y, int font) override { gfx.drawString(text, x, y, font); }
+
+    private:
+        Gfx &gfx;
+};
+
+////////////////////////////////////////////////////////////////////
+// MPU6886 on the internal bus (Wire1, shared with touch and AXP192).
+// The accelerometer fills the chip's 1 KB FIFO at accelFifoRateHz and
+// readAccelFifo() empties it in bursts, instead of one transaction
+// per sample. Its wake-on-motion logic flags any axis that changes by
+// more than womThresholdMg from one sample to the next while the game
+// sleeps: a knock or a quick flick, not a slow hand tilt, so the
+// game never naps longer than a simulation step either.
+////////////////////////////////////////////////////////////////////
+#define MPU6886_ADDRESS           0x68
+#define MPU6886_SMPLRT_DIV        0x19
+#define MPU6886_ACCEL_CONFIG2     0x1D
+#define MPU6886_ACCEL_WOM_X_THR   0x20
+#define MPU6886_ACCEL_WOM_Y_THR   0x21
+#define MPU6886_ACCEL_WOM_Z_THR   0x22
+#define MPU6886_FIFO_EN           0x23
+#define MPU6886_INT_PIN_CFG       0x37
+#define MPU6886_INT_ENABLE        0x38
+#define MPU6886_INT_STATUS        0x3A
+#define MPU6886_ACCEL_INTEL_CTRL  0x69
+#define MPU6886_USER_CTRL         0x6A
+#define MPU6886_FIFO_COUNTH       0x72
+#define MPU6886_FIFO_R_W          0x74
+
+class Core2Imu : public HalImu
+{
+    public:
+        void getAccelData(float *accX, float *accY, float *accZ) override
+        {
+            M5.IMU.getAccelData(accX, accY, accZ);
+        }
+
+        // After M5.IMU.Init(), which leaves the accelerometer at +-8 g
+        void begin()
+        {
+            writeReg(MPU6886_SMPLRT_DIV, 1000 / accelFifoRateHz - 1);  // from the 1 kHz internal rate
+            writeReg(MPU6886_ACCEL_CONFIG2, 0x04);                      // DLPF ~21 Hz, fits the 100 Hz rate
+            writeReg(MPU6886_FIFO_EN, 0x08);                            // accelerometer only
+            resetFifo();
+
+            // wake-on-motion: compare every sample against the previous
+            // one, any axis past the threshold; INT is active low and
+            // latched until INT_STATUS is read, but stays disarmed until
+            // the game actually sleeps
+            writeReg(MPU6886_ACCEL_WOM_X_THR, womThresholdMg / 4);     // 4 mg per LSB
+            writeReg(MPU6886_ACCEL_WOM_Y_THR, womThresholdMg / 4);
+            writeReg(MPU6886_ACCEL_WOM_Z_THR, womThresholdMg / 4);
+            writeReg(MPU6886_ACCEL_INTEL_CTRL, 0xC0);
+            writeReg(MPU6886_INT_PIN_CFG, 0xA0);
+            writeReg(MPU6886_INT_ENABLE, 0x00);
+        }
+
+        // Routes the wake-on-motion flags to INT (clearing stale ones first)
+        void armMotionWake(bool armed)
+        {
+            uint8_t status;
+            readRegs(MPU6886_INT_STATUS, &status, 1);
+            writeReg(MPU6886_INT_ENABLE, armed ? 0xE0 : 0x00);
+        }
+
+        // True (once) after an axis moved past the threshold
+        bool motionDetected()
+        {
+            uint8_t status = 0;
+            readRegs(MPU6886_INT_STATUS, &status, 1);
+            return (status & 0xE0) != 0;
+        }
+
+        int readAccelFifo(AccelSample *samples, int maxSamples) override
+        {
+            uint8_t countBytes[2];
+            if (!readRegs(MPU6886_FIFO_COUNTH, countBytes, 2))
+                return 0;
+            int available = (((countBytes[0] & 0x1F) << 8) | countBytes[1]) / packetBytes;
+
+            // when full the chip overwrites old bytes and the packet
+            // boundaries are lost, start over
+            if (available * packetBytes > fifoBytes - packetBytes)
+            {
+                resetFifo();
+                return 0;
+            }
+
+            int count = available < maxSamples ? available : maxSamples;
+            int done = 0;
+            while (done < count)
+            {
+                int chunk = count - done < packetsPerRead ? count - done : packetsPerRead;
+                uint8_t bytes[packetsPerRead * packetBytes];
+                if (!readRegs(MPU6886_FIFO_R_W, bytes, chunk * packetBytes))
+                    break;
+                for (int i = 0; i < chunk; i++)
+                {
+                    const uint8_t *packet = bytes + i * packetBytes;
+                    samples[done + i].x = toMilliG(packet[0], packet[1]);
+                    samples[done + i].y = toMilliG(packet[2], packet[3]);
+                    samples[done + i].z = toMilliG(packet[4], packet[5]);
+                }
+                done += chunk;
+            }
+            return done;
+        }
+
+    private:
+        static const int fifoBytes = 1024;
+        static const int packetBytes = 8;       // accel X/Y/Z, then the temperature the chip always appends
+        static const int packetsPerRead = 15;   // stays inside the 128 byte Wire buffer
+        static const int lsbPerG = 4096;
+        // per sample (10 ms): a jolt wakes the game early, a slow tilt
+        // is only seen when the nap ends
+        static const int womThresholdMg = 40;
+
+        static int16_t toMilliG(uint8_t high, uint8_t low)
+        {
+            return (int16_t)((int32_t)(int16_t)((high << 8) | low) * 1000 / lsbPerG);
+        }
+
+        void resetFifo()
+        {
+            writeReg(MPU6886_USER_CTRL, 0x04);  // FIFO_RST
+            writeReg(MPU6886_USER_CTRL, 0x40);  // FIFO_EN
+        }
+
+        // through I2C_RW, which serializes Wire1 with touch and counts it
+        void writeReg(uint8_t reg, uint8_t value)
+        {
+            I2C_RW::writeRegister(Wire1, MPU6886_ADDRESS, reg, value, "MPU6886 write");
+        }
+
+        bool readRegs(uint8_t reg, uint8_t *bytes, int length)
+        {
+            return I2C_RW::readRegisters(Wire1, MPU6886_ADDRESS, reg, bytes, length, "MPU6886 read");
+        }
+};
+
+class Core2EnvSensor : public HalEnvSensor
+{
+    public:
+        void getTempHumidity(float *temperature, float *humidity) override
+        {
+            I2C_RW::getSht40Data(SHT40_MEASURE_HIGH_PRECISION, temperature, humidity);
+        }
+
+        void requestTempHumidity(EnvPrecision precision) override
+        {
+            static const byte commands[] = {SHT40_MEASURE_LOW_PRECISION, SHT40_MEASURE_MEDIUM_PRECISION,
+                                            SHT40_MEASURE_HIGH_PRECISION};
+            command = commands[precision];
+
+            // a conversion can't be cancelled, drop its result when it lands
+            if (!I2C_RW::queueSht40Measurement(command))
+                superseded = true;
+        }
+
+        bool readTempHumidity(float *temperature, float *humidity) override
+        {
+            I2cStatus status = I2C_RW::takeSht40Data(temperature, humidity);
+            if (status == I2C_DONE && !superseded)
+                return true;
+
+            // stale or failed, start over
+            if (status == I2C_DONE || status == I2C_FAILED)
+            {
+                superseded = false;
+                I2C_RW::queueSht40Measurement(command);
+            }
+            return false;
+        }
+
+    private:
+        byte command = SHT40_MEASURE_HIGH_PRECISION;   // of the latest request
+        bool superseded = false;
+};
+
+class Core2LightSensor : public HalLightSensor
+{
+    public:
+        uint16_t getWhiteLight() override
+        {
+            return I2C_RW::readReg8Addr16Data(VCNL4040_WHITE_DATA, 2, "VCNL4040 white");
+        }
+
+        void requestLight() override
+        {
+            if (!I2C_RW::queueVcnl4040Reads(lightRegs, 2))
+                superseded = true;
+        }
+
+        bool readLight(uint16_t *whiteLight, uint16_t *ambientLight) override
+        {
+            uint16_t data[2];
+            I2cStatus status = I2C_RW::takeVcnl4040Data(data, 2);
+            if (status == I2C_DONE && !superseded)
+            {
+                *whiteLight = data[0];
+                *ambientLight = data[1];
+                return true;
+            }
+
+            if (status == I2C_DONE || status == I2C_FAILED)
+            {
+                superseded = false;
+                I2C_RW::queueVcnl4040Reads(lightRegs, 2);
+            }
+            return false;
+        }
+
+        void setAmbientAlert(uint16_t ambientThreshold) override
+        {
+            uint16_t conf = I2C_RW::readReg8Addr16Data(VCNL4040_ALS_CONF, 2, "VCNL4040 ALS conf");
+            if (ambientThreshold > 0)
+            {
+                I2C_RW::writeReg8Addr16Data(VCNL4040_ALS_THDH, ambientThreshold, "VCNL4040 ALS high threshold");
+                I2C_RW::writeReg8Addr16Data(VCNL4040_ALS_THDL, 0, "VCNL4040 ALS low threshold");
+                conf |= VCNL4040_ALS_INT_EN;
+            }
+            else
+                conf &= ~VCNL4040_ALS_INT_EN;
+            I2C_RW::writeReg8Addr16Data(VCNL4040_ALS_CONF, conf, "VCNL4040 ALS conf");
+
+            // start from a clean flag
+            I2C_RW::readReg8Addr16Data(VCNL4040_INT_FLAG, 2, "VCNL4040 INT flag");
+            alertArmed = ambientThreshold > 0;
+            alertPin = false;
+            nextFlagPollMs = millis();
+        }
+
+        bool ambientAlerted() override
+        {
+            if (!alertArmed)
+                return false;
+#if MAZE_ALS_INT_PIN >= 0
+            if (!alertPin)
+                return false;
+#else
+            // no INT line: poll the latched flag, no faster than the
+            // sensor can raise it
+            if ((long)(millis() - nextFlagPollMs) < 0)
+                return false;
+            nextFlagPollMs = millis() + flagPollMs;
+#endif
+            alertPin = false;
+            uint16_t flags = I2C_RW::readReg8Addr16Data(VCNL4040_INT_FLAG, 2, "VCNL4040 INT flag");
+            return (flags & VCNL4040_ALS_IF_H) != 0;
+        }
+
+        static void IRAM_ATTR onAlertInt()
+        {
+            alertPin = true;
+        }
+
+    private:
+        // Fallback poll without an INT pin: once per ALS integration
+        // period, the soonest the flag can change. A watch is only armed
+        // while the hat sits on an unbloomed flower, so this traffic is
+        // limited to those moments and a bloom lands within one period.
+        static const unsigned long flagPollMs = 80;
+
+        const byte lightRegs[2] = {VCNL4040_WHITE_DATA, VCNL4040_ALS_DATA};
+        bool superseded = false;
+        bool alertArmed = false;
+        unsigned long nextFlagPollMs = 0;
+        static volatile bool alertPin;  // set by the INT line
+};
+
+volatile bool Core2LightSensor::alertPin = false;
+
+class Core2Speaker : public HalSpeaker
+{
+    public:
+        void dingDong() override { M5.Spk.DingDong(); }
+};
+
+static Core2Display<M5Display> core2Display(M5.Lcd);
+static Core2Imu core2Imu;
+static Core2EnvSensor core2Env;
+static Core2LightSensor core2Light;
+static Core2Speaker core2Speaker;
+
+HalDisplay *Hal::lcd = &core2Display;
+HalImu *Hal::imu = &core2Imu;
+HalEnvSensor *Hal::env = &core2Env;
+HalLightSensor *Hal::light = &core2Light;
+HalSpeaker *Hal::spk = &core2Speaker;
+
+////////////////////////////////////////////////////////////////////
+// ILI9342 hardware vertical scroll. The Core2's landscape rotation is
+// the panel's native scan, so its 240 gate lines are the screen rows
+// and the scroll start moves the picture up and down.
+////////////////////////////////////////////////////////////////////
+#define ILI9342_VSCRDEF           0x33
+#define ILI9342_VSCRSADD          0x37
+
+static void writeScroll(int lines)
+{
+    M5.Lcd.startWrite();
+    M5.Lcd.writecommand(ILI9342_VSCRSADD);
+    M5.Lcd.writedata(lines >> 8);
+    M5.Lcd.writedata(lines & 0xFF);
+    M5.Lcd.endWrite();
+}
+
+static void beginScroll()
+{
+    // the whole screen scrolls, no fixed lines above or below
+    int lines = M5.Lcd.height();
+    M5.Lcd.startWrite();
+    M5.Lcd.writecommand(ILI9342_VSCRDEF);
+    M5.Lcd.writedata(0);
+    M5.Lcd.writedata(0);
+    M5.Lcd.writedata(lines >> 8);
+    M5.Lcd.writedata(lines & 0xFF);
+    M5.Lcd.writedata(0);
+    M5.Lcd.writedata(0);
+    M5.Lcd.endWrite();
+    writeScroll(0);
+}
+
+#if MAZE_FRAMEBUFFER
+////////////////////////////////////////////////////////////////////
+// Framebuffer mode: two full-screen sprites in PSRAM, the changed
+// rows of the finished one are sent to the ILI9342 over DMA. The
+// ESP32's SPI DMA can't read PSRAM, so the rows go out in strips
+// through two small bounce buffers in internal RAM: one strip is
+// copied while the previous one is being sent.
+////////////////////////////////////////////////////////////////////
+static TFT_eSprite frameA = TFT_eSprite(&M5.Lcd);
+static TFT_eSprite frameB = TFT_eSprite(&M5.Lcd);
+static Core2Display<TFT_eSprite> frameDisplayA(frameA);
+static Core2Display<TFT_eSprite> frameDisplayB(frameB);
+static FrameBuffer frameBuffer;
+static bool frameRowsPending = false;
+static int pendingScroll = -1;  // applied once the rows drawn for it are pushed
+
+static const int frameStripRows = 16;   // 10 KB per bounce buffer at 320 px
+static uint16_t *frameStrips[2] = {NULL, NULL};
+
+static void pushFrameRows(const uint16_t *rows, int y, int h)
+{
+    int width = M5.Lcd.width();
+
+    // sprite pixels are already stored in panel byte order
+    M5.Lcd.setSwapBytes(false);
+    M5.Lcd.startWrite();
+    for (int strip = 0; h > 0; strip ^= 1)
+    {
+        int stripRows = h < frameStripRows ? h : frameStripRows;
+
+        // this buffer's last transfer finished before the other one was queued
+        memcpy(frameStrips[strip], rows, stripRows * width * sizeof(uint16_t));
+        M5.Lcd.pushImageDMA(0, y, width, stripRows, frameStrips[strip]);
+
+        rows += stripRows * width;
+        y += stripRows;
+        h -= stripRows;
+    }
+    M5.Lcd.setSwapBytes(true);
+    frameRowsPending = true;
+}
+
+static void waitForFrameRows()
+{
+    // the bus stays held until the transfer is done
+    if (frameRowsPending)
+    {
+        M5.Lcd.dmaWait();
+        M5.Lcd.endWrite();
+        frameRowsPending = false;
+    }
+}
+
+static bool beginFrameBuffer()
+{
+    if (!psramFound())
+        return false;
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (!frameStrips[i])
+            frameStrips[i] = (uint16_t *)heap_caps_malloc(frameStripRows * M5.Lcd.width() * sizeof(uint16_t),
+                                                          MALLOC_CAP_DMA);
+        if (!frameStrips[i])
+            return false;
+    }
+
+    TFT_eSprite *frames[] = {&frameA, &frameB};
+    for (int i = 0; i < 2; i++)
+    {
+        TFT_eSprite *frame = frames[i];
+        frame->setColorDepth(16);
+        frame->setPsram(true);
+        frame->setSwapBytes(true);
+        if (!frame->createSprite(M5.Lcd.width(), M5.Lcd.height()))
+            return false;
+        frame->fillSprite(TFT_BLACK);
+    }
+
+    M5.Lcd.initDMA();
+    frameBuffer.begin(&frameDisplayA, (uint16_t *)frameA.getPointer(),
+                      &frameDisplayB, (uint16_t *)frameB.getPointer(),
+                      pushFrameRows, waitForFrameRows);
+    return true;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////
+// Touch input: the FT6336U pulls INT low while a finger is down. The
+// ISR only timestamps edges into a ring; the controller is read over
+// I2C (by M5.update()) only while a touch is active or just ended.
+////////////////////////////////////////////////////////////////////
+static const gpio_num_t touchIntPin = GPIO_NUM_39;
+static const uint8_t FT6336U_ADDRESS = 0x38;
+static const unsigned long touchGraceMs = 600;  // keep reading this long after a touch (releases, double taps)
+static const unsigned long motionPollMs = 20;   // wake-on-motion check interval without an INT pin
+
+static SpscRing<unsigned long, 8> touchEdges;   // ISR -> loop
+static unsigned long lastTouchMs = 0;
+static bool touchSeen = false;
+
+static void IRAM_ATTR onTouchInt()
+{
+    touchEdges.push(millis());
+}
+
+static void attachTouchInt()
+{
+    attachInterrupt(digitalPinToInterrupt(touchIntPin), onTouchInt, CHANGE);
+}
+
+static void beginTouch()
+{
+    pinMode(touchIntPin, INPUT);
+    attachTouchInt();
+}
+
+// True while a finger is down or for touchGraceMs after the last edge
+static bool touchActive()
+{
+    unsigned long edgeMs;
+    while (touchEdges.pop(edgeMs))
+    {
+        lastTouchMs = edgeMs;
+        touchSeen = true;
+    }
+    if (gpio_get_level(touchIntPin) == 0)
+    {
+        lastTouchMs = millis();
+        touchSeen = true;
+    }
+    return touchSeen && millis() - lastTouchMs < touchGraceMs;
+}
+
+////////////////////////////////////////////////////////////////////
+// Power management: dynamic frequency scaling and light sleep through
+// esp_pm when the core was built with it, a fixed clock per profile
+// otherwise
+////////////////////////////////////////////////////////////////////
+static bool pmEnabled = false;
+static esp_pm_lock_handle_t fullSpeedLock;  // CPU at max_freq while held
+static esp_pm_lock_handle_t noSleepLock;    // no automatic light sleep while held
+static bool fullSpeedHeld = false;
+static PowerProfile powerProfile = POWER_INTERACTIVE;
+
+static bool configurePm(int maxMhz)
+{
+    esp_pm_config_esp32_t config = {};
+    config.max_freq_mhz = maxMhz;
+    config.min_freq_mhz = 80;
+    config.light_sleep_enable = true;
+    return esp_pm_configure(&config) == ESP_OK;
+}
+
+static void beginPowerManagement()
+{
+    pmEnabled = configurePm(240);
+    if (pmEnabled)
+    {
+        esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "frame", &fullSpeedLock);
+        esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "interactive", &noSleepLock);
+        // starts out interactive
+        esp_pm_lock_acquire(noSleepLock);
+    }
+    else
+        Serial.println("esp_pm not available, using fixed CPU clocks");
+}
+
+void Hal::setPowerProfile(PowerProfile profile)
+{
+    if (profile == powerProfile)
+        return;
+    powerProfile = profile;
+
+    int maxMhz = profile == POWER_STATIC ? 80 : 240;
+    if (!pmEnabled)
+    {
+        setCpuFrequencyMhz(maxMhz);
+        return;
+    }
+
+    configurePm(maxMhz);
+    if (profile == POWER_STATIC)
+        esp_pm_lock_release(noSleepLock);
+    else
+        esp_pm_lock_acquire(noSleepLock);
+}
+
+void Hal::holdFullSpeed(bool hold)
+{
+    if (!pmEnabled || hold == fullSpeedHeld)
+        return;
+    fullSpeedHeld = hold;
+    if (hold)
+        esp_pm_lock_acquire(fullSpeedLock);
+    else
+        esp_pm_lock_release(fullSpeedLock);
+}
+
+// Light-sleeps for up to maxMs or until the touch INT (or imuPin, when
+// given) goes low
+static esp_sleep_wakeup_cause_t lightSleep(unsigned long maxMs, int imuPin)
+{
+    Hal::holdFullSpeed(false);
+#if MAZE_FRAMEBUFFER
+    // the panel DMA must not be cut off by the sleep
+    waitForFrameRows();
+#endif
+    // the level wake source replaces the pin's edge interrupt while asleep
+    detachInterrupt(digitalPinToInterrupt(touchIntPin));
+    esp_sleep_enable_timer_wakeup((uint64_t)maxMs * 1000);
+    gpio_wakeup_enable(touchIntPin, GPIO_INTR_LOW_LEVEL);
+    if (imuPin >= 0)
+        gpio_wakeup_enable((gpio_num_t)imuPin, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+
+    // the sensor task on core 0 may be mid-transfer, let it finish and keep
+    // it off both buses until the clocks are back
+    I2C_RW::holdBuses();
+    esp_light_sleep_start();
+    I2C_RW::releaseBuses();
+
+    gpio_wakeup_disable(touchIntPin);
+    if (imuPin >= 0)
+        gpio_wakeup_disable((gpio_num_t)imuPin);
+    attachTouchInt();
+
+    esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+    if (cause == ESP_SLEEP_WAKEUP_GPIO && (imuPin < 0 || gpio_get_level(touchIntPin) == 0))
+    {
+        lastTouchMs = millis();
+        touchSeen = true;
+    }
+    return cause;
+}
+
+bool Hal::sleepUntilTouch(unsigned long maxMs)
+{
+    // keep polling while a finger is down or just lifted, so M5.update()
+    // sees releases and double taps
+    if (touchActive())
+        return false;
+
+    lightSleep(maxMs, -1);
+    return true;
+}
+
+bool Hal::sleepUntilMotion(unsigned long maxMs)
+{
+    if (touchActive())
+        return false;
+
+    core2Imu.armMotionWake(true);
+#if MAZE_IMU_INT_PIN >= 0
+    lightSleep(maxMs, MAZE_IMU_INT_PIN);
+#else
+    // INT is not wired to a GPIO: nap in short slices and check the
+    // latched flags in between, one status byte instead of a FIFO burst.
+    // Slow tilts don't set them, the caller's maxMs bounds that latency.
+    unsigned long start = millis();
+    while (millis() - start < maxMs)
+    {
+        if (lightSleep(motionPollMs, -1) == ESP_SLEEP_WAKEUP_GPIO || core2Imu.motionDetected())
+            break;
+    }
+#endif
+    core2Imu.armMotionWake(false);
+    return true;
+}
+
+void Hal::begin()
+{
+    // Initialize the device
+    M5.begin();
+    M5.Lcd.setSwapBytes(true); // sprites and bitmaps are stored native-endian
+    beginScroll();
+    M5.IMU.Init();
+
+    // Port A bus shared by the Adafruit drivers (setup only) and I2C_RW,
+    // which also arbitrates the internal bus from here on
+    I2C_RW::initI2C(0x60, 0x44, portABusHz, SDA, SCL);
+    Wire1.setClock(internalBusHz);
+    core2Imu.begin();
+    M5.Spk.begin();
+    beginTouch();
+#if MAZE_ALS_INT_PIN >= 0
+    // open drain, active low
+    pinMode(MAZE_ALS_INT_PIN, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(MAZE_ALS_INT_PIN), Core2LightSensor::onAlertInt, FALLING);
+#endif
+    beginPowerManagement();
+
+    // Initialize VCNL4040
+    if (!vcnl4040.begin())
+    {
+        Serial.println("Couldn't find VCNL4040 chip");
+        while (1)
+            delay(1);
+    }
+    Serial.println("Found VCNL4040 chip");
+
+    // Initialize SHT40
+    if (!sht4.begin())
+    {
+        Serial.println("Couldn't find SHT4x");
+        while (1)
+            delay(1);
+    }
+    Serial.println("Found SHT4x sensor");
+    // in case the drivers' begin() reset the clock
+    Wire.setClock(portABusHz);
+
+#if MAZE_FRAMEBUFFER
+    if (beginFrameBuffer())
+        Hal::lcd = &frameBuffer;
+    else
+        Serial.println("No PSRAM for the framebuffer, drawing directly");
+#endif
+}
+
+void Hal::update()
+{
+    // touch and the touch buttons only need the controller while touched.
+    // The M5 library reads it on Wire1, so hold that bus like any other user.
+    // The game's handlers only queue events in here (see handleTouches in
+    // main.cpp), so the lock covers the read, not what a tap does.
+    if (touchActive())
+    {
+        I2C_RW::lockBus(Wire1);
+        M5.update();
+        I2C_RW::unlockBus(Wire1, FT6336U_ADDRESS, 0, true);
+    }
+    I2C_RW::drainLog(4);
+
+#if I2C_LOG_LEVEL >= 2
+    static unsigned long nextStatsMs = 0;
+    if ((long)(millis() - nextStatsMs) >= 0)
+    {
+        I2C_RW::printBusStats();
+        nextStatsMs = millis() + 10000;
+    }
+#endif
+}
+
+void Hal::serviceSensors()
+{
+    I2C_RW::service();
+}
+
+void Hal::present()
+{
+#if MAZE_FRAMEBUFFER
+    if (Hal::lcd == &frameBuffer)
+    {
+        frameBuffer.present();
+        if (pendingScroll >= 0)
+        {
+            waitForFrameRows();
+            writeScroll(pendingScroll);
+            pendingScroll = -1;
+        }
+    }
+#endif
+}
+
+void Hal::scrollVertically(int lines)
+{
+#if MAZE_FRAMEBUFFER
+    if (Hal::lcd == &frameBuffer)
+    {
+        pendingScroll = lines;
+        return;
+    }
+#endif
+    writeScroll(lines);
+}
+
+#endif
@@ -0,0 +1,135 @@
+#include "HintField.h"
+
+const FloorTile *HintField::grid = NULL;
+int HintField::gridWidth = 0;
+int HintField::gridHeight = 0;
+
+uint16_t HintField::flowerDistance[HintField::maxCells];
+uint16_t HintField::nearestFlower[HintField::maxCells];
+uint16_t HintField::endDistance[HintField::maxCells];
+uint16_t HintField::queue[HintField::maxCells];
+
+void HintField::build(const FloorTile *cells, int width, int height, int endX, int endY)
+{
+    grid = cells;
+    gridWidth = width;
+    gridHeight = height;
+    int count = width * height;
+
+    // every bud is a source of the flower field
+    int seeds = 0;
+    for (int cell = 0; cell < count; cell++)
+    {
+        endDistance[cell] = UNREACHED;
+        flowerDistance[cell] = UNREACHED;
+        if (tileFloor(grid[cell]) == FLOWER)
+        {
+            flowerDistance[cell] = 0;
+            nearestFlower[cell] = cell;
+            queue[seeds++] = cell;
+        }
+    }
+    spread(flowerDistance, seeds);
+
+    int end = endY * width + endX;
+    endDistance[end] = 0;
+    queue[0] = end;
+    spread(endDistance, 1);
+}
+
+void HintField::bloom(int col, int row)
+{
+    int bloomed = row * gridWidth + col;
+    int count = gridWidth * gridHeight;
+    if (flowerDistance[bloomed] != 0 || nearestFlower[bloomed] != bloomed)
+        return;
+
+    // forget the tiles that were counting to this bud
+    for (int cell = 0; cell < count; cell++)
+    {
+        if (flowerDistance[cell] != UNREACHED && nearestFlower[cell] == bloomed)
+            flowerDistance[cell] = UNREACHED;
+    }
+
+    // the tiles bordering them keep their distances and refill them
+    int seeds = 0;
+    for (int cell = 0; cell < count; cell++)
+    {
+        if (flowerDistance[cell] == UNREACHED)
+            continue;
+        FloorTile tile = grid[cell];
+        if (((tile & OPEN_LEFT) && flowerDistance[cell - 1] == UNREACHED) ||
+            ((tile & OPEN_RIGHT) && flowerDistance[cell + 1] == UNREACHED) ||
+            ((tile & OPEN_ABOVE) && flowerDistance[cell - gridWidth] == UNREACHED) ||
+            ((tile & OPEN_BELOW) && flowerDistance[cell + gridWidth] == UNREACHED))
+        {
+            // insertion sort, the border is short
+            int i = seeds++;
+            for (; i > 0 && flowerDistance[queue[i - 1]] > flowerDistance[cell]; i--)
+                queue[i] = queue[i - 1];
+            queue[i] = cell;
+        }
+    }
+    spread(flowerDistance, seeds);
+}
+
+uint8_t HintField::hint(int col, int row, bool toEnd)
+{
+    const uint16_t *distance = toEnd ? endDistance : flowerDistance;
+    int cell = row * gridWidth + col;
+    uint16_t here = distance[cell];
+    FloorTile tile = grid[cell];
+
+    if (here == 0 || here == UNREACHED)
+        return 0;
+    if ((tile & OPEN_LEFT) && distance[cell - 1] < here)
+        return OPEN_LEFT;
+    if ((tile & OPEN_RIGHT) && distance[cell + 1] < here)
+        return OPEN_RIGHT;
+    if ((tile & OPEN_ABOVE) && distance[cell - gridWidth] < here)
+        return OPEN_ABOVE;
+    if ((tile & OPEN_BELOW) && distance[cell + gridWidth] < here)
+        return OPEN_BELOW;
+    return 0;
+}
+
+// Breadth-first fill from queue[0, seedCount), seeds sorted by distance. The
+// seeds and the FIFO of newly reached tiles are merged so tiles are always
+// taken nearest first. Tiles still UNREACHED get filled; the flower field
+// also inherits the nearest bud. The maze is valid (MazeSolver), so no
+// opening leads off the grid.
+void HintField::spread(uint16_t *distance, int seedCount)
+{
+    bool flowers = distance == flowerDistance;
+    int seedHead = 0;
+    int head = seedCount;
+    int tail = seedCount;
+
+    while (seedHead < seedCount || head < tail)
+    {
+        int cell;
+        if (head == tail || (seedHead < seedCount && distance[queue[seedHead]] <= distance[queue[head]]))
+            cell = queue[seedHead++];
+        else
+            cell = queue[head++];
+
+        FloorTile tile = grid[cell];
+        uint16_t next = distance[cell] + 1;
+        int neighbours[4] = {
+            (tile & OPEN_LEFT) ? cell - 1 : -1,
+            (tile & OPEN_RIGHT) ? cell + 1 : -1,
+            (tile & OPEN_ABOVE) ? cell - gridWidth : -1,
+            (tile & OPEN_BELOW) ? cell + gridWidth : -1,
+        };
+        for (int i = 0; i < 4; i++)
+        {
+            int neighbour = neighbours[i];
+            if (neighbour < 0 || distance[neighbour] != UNREACHED)
+                continue;
+            distance[neighbour] = next;
+            if (flowers)
+                nearestFlower[neighbour] = nearestFlower[cell];
+            queue[tail++] = neighbour;
+        }
+    }
+}
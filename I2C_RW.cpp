@@ -0,0 +1,643 @@
+#ifdef ARDUINO
+
+#include "I2C_RW.h"
+
+// Members
+int I2C_RW::i2cVcnl4040Address = 0x60;
+int I2C_RW::i2cSht40Address = 0x44;
+int I2C_RW::i2cFrequency = 100000;
+int I2C_RW::i2cSdaPin = SDA;
+int I2C_RW::i2cSclPin = SCL;
+
+I2C_RW::Transaction I2C_RW::queue[I2C_RW::maxTransactions];
+int I2C_RW::queueCount = 0;
+
+I2cStatus I2C_RW::sht40Status = I2C_IDLE;
+uint8_t I2C_RW::sht40Raw[6];
+I2cStatus I2C_RW::vcnl4040Status = I2C_IDLE;
+uint8_t I2C_RW::vcnl4040Raw[2 * I2C_RW::maxBatchRegs];
+int I2C_RW::vcnl4040Count = 0;
+
+SemaphoreHandle_t I2C_RW::busLocks[I2C_RW::busCount];
+unsigned long I2C_RW::lockedAtUs[I2C_RW::busCount];
+I2cDeviceStats I2C_RW::deviceStats[I2C_RW::maxDevices];
+unsigned long I2C_RW::statsSinceUs = 0;
+
+SpscRing<I2C_RW::LogEntry, 32> I2C_RW::logRing;
+portMUX_TYPE I2C_RW::logProducers = portMUX_INITIALIZER_UNLOCKED;
+std::atomic<unsigned long> I2C_RW::logDropped(0);
+
+/////////////////////////////////////////////////////////////////////////////
+// Initialization and debugging
+/////////////////////////////////////////////////////////////////////////////
+void I2C_RW::initI2C(int i2cVcnl4040Addr, int i2cSht40ddr, int i2cFreq, int pinSda, int pinScl)
+{
+    i2cVcnl4040Address = i2cVcnl4040Addr;
+    i2cSht40Address = i2cSht40ddr;
+    i2cFrequency = i2cFreq;
+    i2cSdaPin = pinSda;
+    i2cSclPin = pinScl;
+
+    // every device either bus carries, so the table never grows while
+    // two tasks are using it
+    const I2cDeviceStats devices[maxDevices] = {
+        {0, (uint8_t)i2cSht40Address}, {0, (uint8_t)i2cVcnl4040Address}, {0, 0},
+        {1, 0x68}, {1, 0x38}, {1, 0x34}, {1, 0}     // MPU6886, FT6336U, AXP192
+    };
+    memcpy(deviceStats, devices, sizeof(deviceStats));
+    statsSinceUs = micros();
+
+    for (int i = 0; i < busCount; i++)
+        if (!busLocks[i])
+            busLocks[i] = xSemaphoreCreateMutex();
+
+    Wire.begin(i2cSdaPin, i2cSclPin, i2cFrequency);
+}
+
+void I2C_RW::scanI2cLinesForAddresses(bool verboseConnectionFailures)
+{
+    int devicesFound = 0;
+    Serial.println("Scanning I2C lines...");
+
+    for (byte address = 1; address < 127; address++)
+    {
+        Wire.beginTransmission(address);
+        byte returnStatus = Wire.endTransmission();
+
+        if (returnStatus == 0)
+        {
+            Serial.printf("\tDevice found at 0x%02X\n", address);
+            devicesFound++;
+        }
+        else if (verboseConnectionFailures)
+            Serial.printf("\tNo device at 0x%02X (status %d)\n", address, returnStatus);
+    }
+
+    Serial.printf("Scan done, %d device(s) found\n", devicesFound);
+}
+
+void I2C_RW::printI2cReturnStatus(byte returnStatus, int bytesWritten, const char action[])
+{
+    switch (returnStatus)
+    {
+        case 0:
+            Serial.printf("%s: success, %d byte(s) written\n", action, bytesWritten);
+            break;
+        case 1:
+            Serial.printf("%s: data too long for the transmit buffer\n", action);
+            break;
+        case 2:
+            Serial.printf("%s: address NACK\n", action);
+            break;
+        case 3:
+            Serial.printf("%s: data NACK\n", action);
+            break;
+        case 5:
+            Serial.printf("%s: timeout\n", action);
+            break;
+        default:
+            Serial.printf("%s: other error (%d)\n", action, returnStatus);
+            break;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Bus locks and utilization
+/////////////////////////////////////////////////////////////////////////////
+void I2C_RW::lockBus(TwoWire &bus)
+{
+    int index = busIndex(bus);
+    xSemaphoreTake(busLocks[index], portMAX_DELAY);
+    lockedAtUs[index] = micros();
+}
+
+void I2C_RW::unlockBus(TwoWire &bus, uint8_t address, int bytes, bool ok)
+{
+    int index = busIndex(bus);
+    unsigned long busyUs = micros() - lockedAtUs[index];
+
+    // only touched under this bus's lock
+    I2cDeviceStats *entry = NULL;
+    for (int i = 0; i < maxDevices; i++)
+    {
+        if (deviceStats[i].bus != index)
+            continue;
+        if (deviceStats[i].address == address)
+        {
+            entry = &deviceStats[i];
+            break;
+        }
+        if (deviceStats[i].address == 0)
+            entry = &deviceStats[i];
+    }
+    if (entry)
+    {
+        entry->transactions++;
+        entry->bytes += bytes;
+        entry->busyUs += busyUs;
+        if (!ok)
+            entry->failures++;
+    }
+
+    xSemaphoreGive(busLocks[index]);
+}
+
+void I2C_RW::holdBuses()
+{
+    for (int i = 0; i < busCount; i++)
+        xSemaphoreTake(busLocks[i], portMAX_DELAY);
+}
+
+void I2C_RW::releaseBuses()
+{
+    for (int i = busCount - 1; i >= 0; i--)
+        xSemaphoreGive(busLocks[i]);
+}
+
+bool I2C_RW::readRegisters(TwoWire &bus, uint8_t address, uint8_t reg, uint8_t * bytes, int length, I2cTag action)
+{
+    lockBus(bus);
+    bus.beginTransmission(address);
+    bus.write(reg);
+    byte returnStatus = bus.endTransmission(false); // repeated start
+    int bytesRead = 0;
+    if (returnStatus == 0)
+    {
+        bytesRead = bus.requestFrom(address, (uint8_t)length);
+        for (int i = 0; i < bytesRead; i++)
+        {
+            uint8_t value = bus.read();
+            if (i < length)
+                bytes[i] = value;
+        }
+    }
+    bool ok = returnStatus == 0 && bytesRead == length;
+    unlockBus(bus, address, 1 + bytesRead, ok);
+
+    if (!ok)
+        log<logFailures>(action.name, returnStatus ? returnStatus : statusShortRead, bytesRead, reg);
+    return ok;
+}
+
+bool I2C_RW::writeRegister(TwoWire &bus, uint8_t address, uint8_t reg, uint8_t value, I2cTag action)
+{
+    lockBus(bus);
+    bus.beginTransmission(address);
+    bus.write(reg);
+    bus.write(value);
+    byte returnStatus = bus.endTransmission();
+    unlockBus(bus, address, 2, returnStatus == 0);
+
+    if (returnStatus != 0)
+        log<logFailures>(action.name, returnStatus, 2, value);
+    return returnStatus == 0;
+}
+
+int I2C_RW::busStats(const I2cDeviceStats ** stats)
+{
+    *stats = deviceStats;
+    return maxDevices;
+}
+
+void I2C_RW::printBusStats()
+{
+    unsigned long elapsedUs = micros() - statsSinceUs;
+    Serial.println("I2C bus use:");
+    for (int i = 0; i < maxDevices; i++)
+    {
+        const I2cDeviceStats &entry = deviceStats[i];
+        if (entry.transactions == 0)
+            continue;
+        Serial.printf("\t%s 0x%02X: %lu transactions (%lu failed), %lu bytes, %lu us busy (%.2f%%)\n",
+                      entry.bus ? "Wire1" : "Wire", entry.address, entry.transactions, entry.failures,
+                      entry.bytes, entry.busyUs, elapsedUs ? 100.0f * entry.busyUs / elapsedUs : 0.0f);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Logging. Producers only copy a few words into the ring, the formatting
+// and the Serial write happen in drainLog(). Both tasks log (the sensor
+// task from service(), the loop task from its own blocking accesses), so
+// pushes are serialized to keep the ring single-producer.
+/////////////////////////////////////////////////////////////////////////////
+template <int Level>
+void I2C_RW::log(const char * tag, uint8_t returnStatus, int bytes, uint16_t data)
+{
+    if (Level > I2C_LOG_LEVEL)
+        return;
+
+    LogEntry entry = {tag, micros(), data, returnStatus, (uint8_t)bytes};
+    portENTER_CRITICAL(&logProducers);
+    bool pushed = logRing.push(entry);
+    portEXIT_CRITICAL(&logProducers);
+    if (!pushed)
+        logDropped++;
+}
+
+void I2C_RW::drainLog(int maxEntries)
+{
+    LogEntry entry;
+    while (maxEntries-- > 0 && logRing.pop(entry))
+    {
+        Serial.printf("[%lu us] ", entry.timeUs);
+        if (entry.returnStatus == statusShortRead)
+            Serial.printf("%s: short read, %d byte(s)\n", entry.tag, entry.bytes);
+        else if (entry.returnStatus == statusBadCrc)
+            Serial.printf("%s: CRC mismatch\n", entry.tag);
+        else if (entry.returnStatus == statusMismatch)
+            Serial.printf("%s: read back 0x%04X\n", entry.tag, entry.data);
+        else if (entry.returnStatus == 0)
+            Serial.printf("%s: 0x%04X (%d bytes)\n", entry.tag, entry.data, entry.bytes);
+        else
+            printI2cReturnStatus(entry.returnStatus, entry.bytes, entry.tag);
+    }
+
+    unsigned long dropped = logDropped.exchange(0);
+    if (dropped)
+        Serial.printf("I2C log: %lu line(s) dropped\n", dropped);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// SHT40 helpers
+/////////////////////////////////////////////////////////////////////////////
+
+// Worst case conversion times from the datasheet, rounded up
+unsigned long I2C_RW::sht40ConversionUs(byte command)
+{
+    switch (command)
+    {
+        case SHT40_MEASURE_LOW_PRECISION:
+            return 2000;
+        case SHT40_MEASURE_MEDIUM_PRECISION:
+            return 5000;
+        default:
+            return 9000;
+    }
+}
+
+// CRC-8, polynomial 0x31, init 0xFF (Sensirion)
+static uint8_t sht40Crc(const uint8_t * data)
+{
+    uint8_t crc = 0xFF;
+    for (int i = 0; i < 2; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+    }
+    return crc;
+}
+
+bool I2C_RW::decodeSht40(const uint8_t * raw, float * temperature, float * humidity)
+{
+    if (sht40Crc(raw) != raw[2] || sht40Crc(raw + 3) != raw[5])
+        return false;
+
+    uint16_t rawTemp = (raw[0] << 8) | raw[1];
+    uint16_t rawHum = (raw[3] << 8) | raw[4];
+
+    *temperature = -45.0f + 175.0f * rawTemp / 65535.0f;
+    *humidity = -6.0f + 125.0f * rawHum / 65535.0f;
+    if (*humidity < 0)
+        *humidity = 0;
+    if (*humidity > 100)
+        *humidity = 100;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// 8-bit register methods (blocking)
+/////////////////////////////////////////////////////////////////////////////
+void I2C_RW::getSht40Data(byte regAddr, float * temperature, float * humidity)
+{
+    lockBus(Wire);
+    Wire.beginTransmission(i2cSht40Address);
+    Wire.write(regAddr);
+    byte returnStatus = Wire.endTransmission();
+    unlockBus(Wire, i2cSht40Address, 1, returnStatus == 0);
+    if (returnStatus != 0)
+    {
+        log<logFailures>("SHT40 measure", returnStatus, 1, regAddr);
+        return;
+    }
+
+    // the bus is free for others during the conversion
+    delayMicroseconds(sht40ConversionUs(regAddr));
+
+    uint8_t raw[6];
+    lockBus(Wire);
+    int bytesRead = Wire.requestFrom(i2cSht40Address, 6);
+    for (int i = 0; i < bytesRead; i++)
+    {
+        uint8_t value = Wire.read();
+        if (i < 6)
+            raw[i] = value;
+    }
+    unlockBus(Wire, i2cSht40Address, bytesRead, bytesRead == 6);
+    if (bytesRead != 6)
+    {
+        log<logFailures>("SHT40 measure", statusShortRead, bytesRead, regAddr);
+        return;
+    }
+
+    if (!decodeSht40(raw, temperature, humidity))
+        log<logFailures>("SHT40 measure", statusBadCrc, 6, regAddr);
+}
+
+template <bool Verbose>
+uint16_t I2C_RW::readReg8Addr16Data(byte regAddr, int numBytesToRead, I2cTag action)
+{
+    lockBus(Wire);
+    Wire.beginTransmission(i2cVcnl4040Address);
+    Wire.write(regAddr);
+    byte returnStatus = Wire.endTransmission(false); // repeated start
+    if (returnStatus != 0)
+    {
+        unlockBus(Wire, i2cVcnl4040Address, 1, false);
+        log<logFailures>(action.name, returnStatus, 1, regAddr);
+        return 0;
+    }
+
+    // LSB first
+    uint16_t data = 0;
+    int bytesRead = Wire.requestFrom(i2cVcnl4040Address, numBytesToRead);
+    for (int i = 0; i < bytesRead; i++)
+    {
+        uint8_t value = Wire.read();
+        if (i < 2)
+            data |= value << (8 * i);
+    }
+    unlockBus(Wire, i2cVcnl4040Address, 1 + bytesRead, bytesRead == numBytesToRead);
+
+    if (bytesRead != numBytesToRead)
+        log<logFailures>(action.name, statusShortRead, bytesRead, data);
+    else if (Verbose)
+        log<logAccesses>(action.name, 0, bytesRead, data);
+    return data;
+}
+
+template <bool Verbose>
+void I2C_RW::writeReg8Addr16Data(byte regAddr, uint16_t data, I2cTag action)
+{
+    lockBus(Wire);
+    Wire.beginTransmission(i2cVcnl4040Address);
+    Wire.write(regAddr);
+    Wire.write(data & 0xFF);
+    Wire.write(data >> 8);
+    byte returnStatus = Wire.endTransmission();
+    unlockBus(Wire, i2cVcnl4040Address, 3, returnStatus == 0);
+
+    if (returnStatus != 0)
+        log<logFailures>(action.name, returnStatus, 3, data);
+    else if (Verbose)
+        log<logAccesses>(action.name, 0, 3, data);
+}
+
+template <bool Verbose>
+bool I2C_RW::writeReg8Addr16DataWithProof(byte regAddr, int numBytesToWrite, uint16_t data, I2cTag action)
+{
+    writeReg8Addr16Data<Verbose>(regAddr, data, action);
+
+    uint16_t readBack = readReg8Addr16Data<Verbose>(regAddr, numBytesToWrite, action);
+    uint16_t mask = numBytesToWrite == 1 ? 0x00FF : 0xFFFF;
+    bool match = (readBack & mask) == (data & mask);
+    if (!match)
+        log<logFailures>(action.name, statusMismatch, numBytesToWrite, readBack);
+    return match;
+}
+
+// The only two flavours there are
+template uint16_t I2C_RW::readReg8Addr16Data<false>(byte, int, I2cTag);
+template uint16_t I2C_RW::readReg8Addr16Data<true>(byte, int, I2cTag);
+template void I2C_RW::writeReg8Addr16Data<false>(byte, uint16_t, I2cTag);
+template void I2C_RW::writeReg8Addr16Data<true>(byte, uint16_t, I2cTag);
+template bool I2C_RW::writeReg8Addr16DataWithProof<false>(byte, int, uint16_t, I2cTag);
+template bool I2C_RW::writeReg8Addr16DataWithProof<true>(byte, int, uint16_t, I2cTag);
+
+/////////////////////////////////////////////////////////////////////////////
+// Transaction engine
+/////////////////////////////////////////////////////////////////////////////
+bool I2C_RW::enqueue(const Transaction &transaction)
+{
+    if (queueCount == maxTransactions)
+        return false;
+    queue[queueCount++] = transaction;
+    return true;
+}
+
+bool I2C_RW::isQueued(const I2cStatus * status)
+{
+    for (int i = 0; i < queueCount; i++)
+        if (queue[i].status == status)
+            return true;
+    return false;
+}
+
+uint8_t I2C_RW::run(const Transaction &transaction)
+{
+    TwoWire &bus = *transaction.bus;
+    byte returnStatus;
+    switch (transaction.type)
+    {
+        case WRITE_COMMAND:
+            bus.beginTransmission(transaction.address);
+            bus.write(transaction.bytes, transaction.length);
+            return bus.endTransmission();
+
+        case READ_BYTES:
+            if (bus.requestFrom(transaction.address, transaction.length) != transaction.length)
+                return statusShortRead;
+            for (int i = 0; i < transaction.length; i++)
+                transaction.readBuffer[i] = bus.read();
+            return 0;
+
+        case READ_REGISTERS:
+            // register address, repeated start, 2 bytes, STOP; per register,
+            // the VCNL4040 doesn't auto-increment and arduino-esp32 ignores
+            // sendStop on reads, so there is no merging them further
+            for (int reg = 0; reg < transaction.length; reg++)
+            {
+                bus.beginTransmission(transaction.address);
+                bus.write(transaction.bytes[reg]);
+                returnStatus = bus.endTransmission(false);
+                if (returnStatus != 0)
+                    return returnStatus;
+                if (bus.requestFrom(transaction.address, (uint8_t)2) != 2)
+                    return statusShortRead;
+                transaction.readBuffer[2 * reg] = bus.read();
+                transaction.readBuffer[2 * reg + 1] = bus.read();
+            }
+            return 0;
+    }
+    return statusShortRead;
+}
+
+void I2C_RW::finish(int index, uint8_t returnStatus)
+{
+    const Transaction &transaction = queue[index];
+    bool ok = returnStatus == 0;
+    if (!ok)
+        log<logFailures>(transaction.tag, returnStatus, transaction.length, transaction.bytes[0]);
+    if (transaction.status && (!ok || transaction.type != WRITE_COMMAND))
+        *transaction.status = ok ? I2C_DONE : I2C_FAILED;
+
+    // the next step of the request waits from now, when the command actually
+    // went out, not from when it was queued
+    if (ok && transaction.settleUs && transaction.status)
+    {
+        for (int i = index + 1; i < queueCount; i++)
+        {
+            if (queue[i].status == transaction.status)
+            {
+                queue[i].notBeforeUs = micros() + transaction.settleUs;
+                break;
+            }
+        }
+    }
+}
+
+// An earlier transaction for the same device hasn't run yet
+bool I2C_RW::waitsBehind(int index, const bool * handled)
+{
+    for (int i = 0; i < index; i++)
+        if (!handled[i] && queue[i].bus == queue[index].bus && queue[i].address == queue[index].address)
+            return true;
+    return false;
+}
+
+void I2C_RW::service()
+{
+    unsigned long now = micros();
+    bool handled[maxTransactions] = {};
+
+    for (int priority = I2C_PRIORITY_INPUT; priority <= I2C_PRIORITY_ENVIRONMENT; priority++)
+    {
+        for (int i = 0; i < queueCount; i++)
+        {
+            Transaction &transaction = queue[i];
+            if (handled[i] || transaction.priority != priority || (long)(now - transaction.notBeforeUs) < 0 ||
+                waitsBehind(i, handled))
+                continue;
+
+            // the rest of a request whose first step failed is dropped
+            handled[i] = true;
+            if (transaction.status && *transaction.status == I2C_FAILED)
+                continue;
+
+            lockBus(*transaction.bus);
+            uint8_t returnStatus = run(transaction);
+            int bytes = transaction.type == READ_REGISTERS ? 3 * transaction.length : transaction.length;
+            unlockBus(*transaction.bus, transaction.address, bytes, returnStatus == 0);
+            finish(i, returnStatus);
+        }
+    }
+
+    // keep what hasn't run, in order, for a later call
+    int kept = 0;
+    for (int i = 0; i < queueCount; i++)
+        if (!handled[i])
+            queue[kept++] = queue[i];
+    queueCount = kept;
+}
+
+bool I2C_RW::queueSht40Measurement(byte command)
+{
+    if (sht40Status == I2C_QUEUED || isQueued(&sht40Status) || queueCount > maxTransactions - 2)
+        return false;
+
+    Transaction measure = {};
+    measure.type = WRITE_COMMAND;
+    measure.priority = I2C_PRIORITY_ENVIRONMENT;
+    measure.tag = "SHT40 measure";
+    measure.bus = &Wire;
+    measure.address = i2cSht40Address;
+    measure.length = 1;
+    measure.bytes[0] = command;
+    measure.status = &sht40Status;
+    measure.notBeforeUs = micros();
+    measure.settleUs = sht40ConversionUs(command);
+
+    Transaction result = {};
+    result.type = READ_BYTES;
+    result.priority = I2C_PRIORITY_ENVIRONMENT;
+    result.tag = "SHT40 result";
+    result.bus = &Wire;
+    result.address = i2cSht40Address;
+    result.length = sizeof(sht40Raw);
+    result.readBuffer = sht40Raw;
+    result.status = &sht40Status;
+    result.notBeforeUs = measure.notBeforeUs;   // pushed back by finish(measure)
+
+    sht40Status = I2C_QUEUED;
+    enqueue(measure);
+    enqueue(result);
+    return true;
+}
+
+I2cStatus I2C_RW::takeSht40Data(float * temperature, float * humidity)
+{
+    I2cStatus status = sht40Status;
+    if (status == I2C_QUEUED || status == I2C_IDLE)
+        return status;
+
+    // a failed command still has its read queued until that is dropped
+    if (isQueued(&sht40Status))
+        return I2C_QUEUED;
+
+    sht40Status = I2C_IDLE;
+    if (status == I2C_DONE && !decodeSht40(sht40Raw, temperature, humidity))
+    {
+        log<logFailures>("SHT40 result", statusBadCrc, sizeof(sht40Raw), 0);
+        return I2C_FAILED;
+    }
+    return status;
+}
+
+bool I2C_RW::queueVcnl4040Reads(const byte * regAddrs, int count)
+{
+    if (count < 1 || count > maxBatchRegs)
+        return false;
+
+    if (vcnl4040Status == I2C_QUEUED)
+    {
+        // the same batch still waiting to run answers this request too
+        for (int i = 0; i < queueCount; i++)
+            if (queue[i].status == &vcnl4040Status && queue[i].length == count &&
+                memcmp(queue[i].bytes, regAddrs, count) == 0)
+                return true;
+        return false;
+    }
+
+    Transaction batch = {};
+    batch.type = READ_REGISTERS;
+    batch.priority = I2C_PRIORITY_INPUT;
+    batch.tag = "VCNL4040 batch";
+    batch.bus = &Wire;
+    batch.address = i2cVcnl4040Address;
+    batch.length = count;
+    memcpy(batch.bytes, regAddrs, count);
+    batch.readBuffer = vcnl4040Raw;
+    batch.status = &vcnl4040Status;
+    batch.notBeforeUs = micros();
+
+    if (!enqueue(batch))
+        return false;
+    vcnl4040Status = I2C_QUEUED;
+    vcnl4040Count = count;
+    return true;
+}
+
+I2cStatus I2C_RW::takeVcnl4040Data(uint16_t * data, int count)
+{
+    I2cStatus status = vcnl4040Status;
+    if (status != I2C_DONE && status != I2C_FAILED)
+        return status;
+
+    vcnl4040Status = I2C_IDLE;
+    if (status == I2C_DONE)
+        for (int i = 0; i < count && i < vcnl4040Count; i++)
+            data[i] = vcnl4040Raw[2 * i] | (vcnl4040Raw[2 * i + 1] << 8);
+    return status;
+}
+
+#endif
@@ -0,0 +1,329 @@
+#include "MazeGenerator.h"
+
+FloorTile *MazeGenerator::grid = NULL;
+int MazeGenerator::gridWidth = 0;
+int MazeGenerator::gridHeight = 0;
+uint32_t MazeGenerator::rngState = 1;
+
+uint16_t MazeGenerator::cellScratch[MazeGenerator::maxCells];
+uint16_t MazeGenerator::edgeScratch[2 * MazeGenerator::maxCells];
+
+// Directions are the bit numbers of the openings (OPEN_LEFT = 1 << 0 ...),
+// so the opposite direction is always direction ^ 1
+static const int directions = 4;
+
+bool MazeGenerator::generate(FloorTile *cells, int width, int height, uint32_t seed, MazeAlgorithm algorithm,
+                             int flowers, int ices, MazeLayout *layout)
+{
+    int count = width * height;
+    if (width < 2 || height < 2 || width > 255 || height > 255 || count > maxCells)
+        return false;
+    if (flowers < 0 || ices < 0 || flowers > 255 || flowers + ices > count - 2)
+        return false;
+
+    grid = cells;
+    gridWidth = width;
+    gridHeight = height;
+    rngState = seed ? seed : 0x9E3779B9; // xorshift can't leave zero
+
+    for (int cell = 0; cell < count; cell++)
+        grid[cell] = withFloor(0, WALKABLE);
+
+    switch (algorithm)
+    {
+        case MAZE_WILSON:
+            wilson();
+            break;
+        case MAZE_KRUSKAL:
+            kruskal();
+            break;
+        default:
+            backtracker();
+            break;
+    }
+
+    for (int cell = 0; cell < count; cell++)
+        grid[cell] &= ~MARK;
+
+    int start = randomBelow(count);
+    int end = farthestFrom(start);
+    grid[start] = withFloor(grid[start], STARTTILE);
+    placeItems(start, end, flowers, ices);
+
+    layout->width = width;
+    layout->height = height;
+    layout->startX = start % width;
+    layout->startY = start / width;
+    layout->endX = end % width;
+    layout->endY = end / width;
+    layout->flowersToBloom = flowers;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////
+// Helpers
+////////////////////////////////////////////////////////////////////
+
+// xorshift32, plenty for level layout and identical on every platform
+uint32_t MazeGenerator::nextRandom()
+{
+    uint32_t x = rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rngState = x;
+    return x;
+}
+
+// Uniform enough in [0, n) without a division
+int MazeGenerator::randomBelow(int n)
+{
+    return (int)(((uint64_t)nextRandom() * (uint32_t)n) >> 32);
+}
+
+int MazeGenerator::neighbour(int cell, int direction)
+{
+    int col = cell % gridWidth;
+    int row = cell / gridWidth;
+    switch (direction)
+    {
+        case 0:
+            return col > 0 ? cell - 1 : -1;
+        case 1:
+            return col < gridWidth - 1 ? cell + 1 : -1;
+        case 2:
+            return row > 0 ? cell - gridWidth : -1;
+        default:
+            return row < gridHeight - 1 ? cell + gridWidth : -1;
+    }
+}
+
+// Knocks down the wall between cell and its neighbour in direction
+void MazeGenerator::carve(int cell, int direction)
+{
+    grid[cell] |= 1 << direction;
+    grid[neighbour(cell, direction)] |= 1 << (direction ^ 1);
+}
+
+////////////////////////////////////////////////////////////////////
+// Algorithms
+////////////////////////////////////////////////////////////////////
+
+// Depth-first search with an explicit stack
+void MazeGenerator::backtracker()
+{
+    uint16_t *stack = cellScratch;
+    int depth = 0;
+
+    int first = randomBelow(gridWidth * gridHeight);
+    grid[first] |= MARK;
+    stack[depth++] = first;
+
+    while (depth > 0)
+    {
+        int cell = stack[depth - 1];
+
+        int options[directions];
+        int optionCount = 0;
+        for (int direction = 0; direction < directions; direction++)
+        {
+            int next = neighbour(cell, direction);
+            if (next >= 0 && !(grid[next] & MARK))
+                options[optionCount++] = direction;
+        }
+
+        if (optionCount == 0)
+        {
+            depth--;
+            continue;
+        }
+
+        int direction = options[randomBelow(optionCount)];
+        int next = neighbour(cell, direction);
+        carve(cell, direction);
+        grid[next] |= MARK;
+        stack[depth++] = next;
+    }
+}
+
+// Loop-erased random walks: each walk remembers only the last direction
+// taken out of every cell, which erases loops for free
+void MazeGenerator::wilson()
+{
+    uint16_t *exitDirection = cellScratch;
+    int count = gridWidth * gridHeight;
+
+    grid[randomBelow(count)] |= MARK;
+
+    for (int origin = 0; origin < count; origin++)
+    {
+        if (grid[origin] & MARK)
+            continue;
+
+        int cell = origin;
+        while (!(grid[cell] & MARK))
+        {
+            int direction, next;
+            do
+            {
+                direction = randomBelow(directions);
+                next = neighbour(cell, direction);
+            } while (next < 0);
+            exitDirection[cell] = direction;
+            cell = next;
+        }
+
+        // add the erased walk to the tree
+        for (cell = origin; !(grid[cell] & MARK);)
+        {
+            int direction = exitDirection[cell];
+            carve(cell, direction);
+            grid[cell] |= MARK;
+            cell = neighbour(cell, direction);
+        }
+    }
+}
+
+// Path-halving find
+int MazeGenerator::findRoot(int cell)
+{
+    uint16_t *parent = cellScratch;
+    while (parent[cell] != cell)
+    {
+        parent[cell] = parent[parent[cell]];
+        cell = parent[cell];
+    }
+    return cell;
+}
+
+// Every inner wall in random order, knocked down when it separates two
+// different trees
+void MazeGenerator::kruskal()
+{
+    uint16_t *parent = cellScratch;
+    uint16_t *edges = edgeScratch;
+    int count = gridWidth * gridHeight;
+
+    // edge id = cell * 2 + (0 right, 1 down)
+    int edgeCount = 0;
+    for (int cell = 0; cell < count; cell++)
+    {
+        parent[cell] = cell;
+        if (cell % gridWidth < gridWidth - 1)
+            edges[edgeCount++] = cell * 2;
+        if (cell / gridWidth < gridHeight - 1)
+            edges[edgeCount++] = cell * 2 + 1;
+    }
+
+    for (int i = edgeCount - 1; i > 0; i--)
+    {
+        int j = randomBelow(i + 1);
+        uint16_t swap = edges[i];
+        edges[i] = edges[j];
+        edges[j] = swap;
+    }
+
+    int joined = 0;
+    for (int i = 0; i < edgeCount && joined < count - 1; i++)
+    {
+        int cell = edges[i] >> 1;
+        int direction = (edges[i] & 1) ? 3 : 1;
+        int a = findRoot(cell);
+        int b = findRoot(neighbour(cell, direction));
+        if (a == b)
+            continue;
+        parent[a] = b;
+        carve(cell, direction);
+        joined++;
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+// Start, end and items
+////////////////////////////////////////////////////////////////////
+
+// Breadth-first search over the openings, the last tile reached is the
+// farthest one (ties go to whichever came first)
+int MazeGenerator::farthestFrom(int start)
+{
+    uint16_t *queue = cellScratch;
+    uint16_t *distance = edgeScratch;
+    int count = gridWidth * gridHeight;
+
+    for (int cell = 0; cell < count; cell++)
+        distance[cell] = 0xFFFF;
+
+    int head = 0;
+    int tail = 0;
+    queue[tail++] = start;
+    distance[start] = 0;
+    int last = start;
+
+    while (head < tail)
+    {
+        int cell = queue[head++];
+        last = cell;
+        for (int direction = 0; direction < directions; direction++)
+        {
+            if (!(grid[cell] & (1 << direction)))
+                continue;
+            int next = neighbour(cell, direction);
+            if (distance[next] != 0xFFFF)
+                continue;
+            distance[next] = distance[cell] + 1;
+            queue[tail++] = next;
+        }
+    }
+    return last;
+}
+
+// Flower buds go to dead ends first (a detour to every one of them), ice
+// anywhere else along the way
+void MazeGenerator::placeItems(int start, int end, int flowers, int ices)
+{
+    uint16_t *candidates = cellScratch;
+    int count = gridWidth * gridHeight;
+
+    // dead ends at the front, every other tile at the back
+    int front = 0;
+    int back = count - 2;
+    for (int cell = 0; cell < count; cell++)
+    {
+        if (cell == start || cell == end)
+            continue;
+        uint8_t openings = grid[cell] & OPEN_MASK;
+        bool deadEnd = (openings & (openings - 1)) == 0;
+        if (deadEnd)
+            candidates[front++] = cell;
+        else
+            candidates[--back] = cell;
+    }
+
+    // shuffle each group on its own, then the leftovers for the ice
+    for (int i = front - 1; i > 0; i--)
+    {
+        int j = randomBelow(i + 1);
+        uint16_t swap = candidates[i];
+        candidates[i] = candidates[j];
+        candidates[j] = swap;
+    }
+    for (int i = count - 3; i > front; i--)
+    {
+        int j = front + randomBelow(i - front + 1);
+        uint16_t swap = candidates[i];
+        candidates[i] = candidates[j];
+        candidates[j] = swap;
+    }
+    for (int i = 0; i < flowers; i++)
+        grid[candidates[i]] = withFloor(grid[candidates[i]], FLOWER);
+
+    for (int i = count - 3; i > flowers; i--)
+    {
+        int j = flowers + randomBelow(i - flowers + 1);
+        uint16_t swap = candidates[i];
+        candidates[i] = candidates[j];
+        candidates[j] = swap;
+    }
+    for (int i = flowers; i < flowers + ices; i++)
+        grid[candidates[i]] = withFloor(grid[candidates[i]], ICE);
+}
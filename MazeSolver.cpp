@@ -0,0 +1,224 @@
+#include "MazeSolver.h"
+
+const FloorTile *MazeSolver::grid = NULL;
+int MazeSolver::gridWidth = 0;
+int MazeSolver::gridHeight = 0;
+int MazeSolver::badX = 0;
+int MazeSolver::badY = 0;
+int MazeSolver::route = -1;
+
+uint16_t MazeSolver::queue[MazeSolver::maxCells];
+uint16_t MazeSolver::distance[MazeSolver::maxCells];
+uint16_t MazeSolver::flowerCells[MazeSolver::maxFlowers];
+uint16_t MazeSolver::legs[MazeSolver::maxFlowers + 2][MazeSolver::maxFlowers + 2];
+uint16_t MazeSolver::bestWalk[1 << MazeSolver::maxFlowers][MazeSolver::maxFlowers];
+
+MazeProblem MazeSolver::check(const FloorTile *cells, int width, int height, int startX, int startY, int endX,
+                              int endY, int flowersToBloom)
+{
+    grid = cells;
+    gridWidth = width;
+    gridHeight = height;
+    badX = 0;
+    badY = 0;
+    route = -1;
+
+    if (width < 1 || height < 1 || width * height > maxCells)
+        return MAZE_BAD_SIZE;
+    if (startX < 0 || startX >= width || startY < 0 || startY >= height)
+        return MAZE_BAD_START;
+    if (endX < 0 || endX >= width || endY < 0 || endY >= height)
+        return MAZE_UNREACHABLE;
+
+    int flowerCount;
+    MazeProblem problem = checkWalls(&flowerCount);
+    if (problem != MAZE_OK)
+        return problem;
+
+    int start = startY * width + startX;
+    int end = endY * width + endX;
+    if (tileFloor(grid[start]) != STARTTILE)
+        return problemAt(MAZE_BAD_START, start);
+
+    // every objective has to be on the start's side of the walls
+    breadthFirst(start);
+    for (int cell = 0; cell < width * height; cell++)
+    {
+        FloorType floor = tileFloor(grid[cell]);
+        if ((floor == FLOWER || floor == ICE || cell == end) && distance[cell] == UNREACHED)
+            return problemAt(MAZE_UNREACHABLE, cell);
+    }
+
+    if (flowersToBloom > flowerCount)
+        return MAZE_TOO_FEW_FLOWERS;
+
+    route = shortestRoute(flowerCount, end, flowersToBloom);
+    return MAZE_OK;
+}
+
+const char *MazeSolver::describe(MazeProblem problem)
+{
+    switch (problem)
+    {
+        case MAZE_OK:
+            return "ok";
+        case MAZE_BAD_SIZE:
+            return "bad size";
+        case MAZE_OPEN_BORDER:
+            return "opening off the grid";
+        case MAZE_ONE_WAY_WALL:
+            return "one-way wall";
+        case MAZE_BAD_START:
+            return "bad start";
+        case MAZE_UNREACHABLE:
+            return "unreachable tile";
+        case MAZE_TOO_FEW_FLOWERS:
+            return "too few flowers";
+        default:
+            return "too many flowers";
+    }
+}
+
+MazeProblem MazeSolver::problemAt(MazeProblem problem, int cell)
+{
+    badX = cell % gridWidth;
+    badY = cell / gridWidth;
+    return problem;
+}
+
+// Every wall has to be seen from both sides, and the edge of the grid is a
+// wall. Also collects the flower buds for the solver.
+MazeProblem MazeSolver::checkWalls(int *flowerCount)
+{
+    *flowerCount = 0;
+    for (int row = 0; row < gridHeight; row++)
+    {
+        for (int col = 0; col < gridWidth; col++)
+        {
+            int cell = row * gridWidth + col;
+            FloorTile tile = grid[cell];
+
+            if ((col == 0 && (tile & OPEN_LEFT)) || (col == gridWidth - 1 && (tile & OPEN_RIGHT)) ||
+                (row == 0 && (tile & OPEN_ABOVE)) || (row == gridHeight - 1 && (tile & OPEN_BELOW)))
+                return problemAt(MAZE_OPEN_BORDER, cell);
+
+            if (col < gridWidth - 1 && !(tile & OPEN_RIGHT) != !(grid[cell + 1] & OPEN_LEFT))
+                return problemAt(MAZE_ONE_WAY_WALL, cell);
+            if (row < gridHeight - 1 && !(tile & OPEN_BELOW) != !(grid[cell + gridWidth] & OPEN_ABOVE))
+                return problemAt(MAZE_ONE_WAY_WALL, cell);
+
+            if (tileFloor(tile) == FLOWER)
+            {
+                if (*flowerCount == maxFlowers)
+                    return problemAt(MAZE_TOO_MANY_FLOWERS, cell);
+                flowerCells[(*flowerCount)++] = cell;
+            }
+        }
+    }
+    return MAZE_OK;
+}
+
+// Steps from one tile to every other, UNREACHED behind walls
+void MazeSolver::breadthFirst(int from)
+{
+    int count = gridWidth * gridHeight;
+    for (int cell = 0; cell < count; cell++)
+        distance[cell] = UNREACHED;
+
+    int head = 0;
+    int tail = 0;
+    queue[tail++] = from;
+    distance[from] = 0;
+
+    while (head < tail)
+    {
+        int cell = queue[head++];
+        FloorTile tile = grid[cell];
+        uint16_t next = distance[cell] + 1;
+
+        // checkWalls() made sure no opening leads off the grid
+        if ((tile & OPEN_LEFT) && distance[cell - 1] == UNREACHED)
+        {
+            distance[cell - 1] = next;
+            queue[tail++] = cell - 1;
+        }
+        if ((tile & OPEN_RIGHT) && distance[cell + 1] == UNREACHED)
+        {
+            distance[cell + 1] = next;
+            queue[tail++] = cell + 1;
+        }
+        if ((tile & OPEN_ABOVE) && distance[cell - gridWidth] == UNREACHED)
+        {
+            distance[cell - gridWidth] = next;
+            queue[tail++] = cell - gridWidth;
+        }
+        if ((tile & OPEN_BELOW) && distance[cell + gridWidth] == UNREACHED)
+        {
+            distance[cell + gridWidth] = next;
+            queue[tail++] = cell + gridWidth;
+        }
+    }
+}
+
+// Held-Karp over the flower buds. Only walks that bloom exactly
+// flowersToBloom buds are ended: walking past an extra bud never makes a
+// route shorter, BFS distances already obey the triangle inequality.
+int MazeSolver::shortestRoute(int flowerCount, int end, int flowersToBloom)
+{
+    const int startLeg = flowerCount;
+    const int endLeg = flowerCount + 1;
+
+    // distance[] still holds the BFS from the start
+    for (int i = 0; i < flowerCount; i++)
+        legs[startLeg][i] = distance[flowerCells[i]];
+    legs[startLeg][endLeg] = distance[end];
+
+    if (flowersToBloom == 0)
+        return legs[startLeg][endLeg];
+
+    for (int i = 0; i < flowerCount; i++)
+    {
+        breadthFirst(flowerCells[i]);
+        for (int j = 0; j < flowerCount; j++)
+            legs[i][j] = distance[flowerCells[j]];
+        legs[i][endLeg] = distance[end];
+    }
+
+    int masks = 1 << flowerCount;
+    for (int mask = 1; mask < masks; mask++)
+        for (int i = 0; i < flowerCount; i++)
+            bestWalk[mask][i] = UNREACHED;
+    for (int i = 0; i < flowerCount; i++)
+        bestWalk[1 << i][i] = legs[startLeg][i];
+
+    int best = -1;
+    for (int mask = 1; mask < masks; mask++)
+    {
+        int bloomed = __builtin_popcount(mask);
+        for (int i = 0; i < flowerCount; i++)
+        {
+            uint16_t walk = bestWalk[mask][i];
+            if (walk == UNREACHED)
+                continue;
+
+            if (bloomed == flowersToBloom)
+            {
+                int total = walk + legs[i][endLeg];
+                if (best < 0 || total < best)
+                    best = total;
+                continue;
+            }
+
+            for (int j = 0; j < flowerCount; j++)
+            {
+                if (mask & (1 << j))
+                    continue;
+                int next = mask | (1 << j);
+                uint16_t extended = walk + legs[i][j];
+                if (extended < bestWalk[next][j])
+                    bestWalk[next][j] = extended;
+            }
+        }
+    }
+    return best;
+}
@@ -0,0 +1,107 @@
+#include "PackedIcon.h"
+#include <stdlib.h>
+
+IconDecoder::IconDecoder(const PackedIcon &packed) : icon(packed)
+{
+    next = icon.data;
+    runColor = 0;
+    runLeft = 0;
+}
+
+void IconDecoder::decodeRow(uint16_t *row)
+{
+    int x = 0;
+    while (x < icon.width)
+    {
+        if (runLeft == 0)
+        {
+            uint8_t token = *next++;
+            if (token & 0x80)
+            {
+                runLeft = (token & 0x7F) + 2;
+                runColor = icon.palette[*next++];
+            }
+            else
+            {
+                runLeft = 1;
+                runColor = icon.palette[token];
+            }
+        }
+
+        int count = icon.width - x;
+        if (count > runLeft)
+            count = runLeft;
+        runLeft -= count;
+        while (count--)
+            row[x++] = runColor;
+    }
+}
+
+IconCache::Slot IconCache::slots[IconCache::slotCount];
+unsigned long IconCache::useCount = 0;
+bool IconCache::allocated = false;
+
+// One block for all slots, tried once
+bool IconCache::allocate()
+{
+    if (allocated)
+        return slots[0].pixels != NULL;
+    allocated = true;
+
+    size_t slotPixels = maxIconSize * maxIconSize;
+    size_t bytes = slotCount * slotPixels * sizeof(uint16_t);
+#ifdef ARDUINO
+    // keep internal RAM for the stacks and DMA
+    uint16_t *block = (uint16_t *)ps_malloc(bytes);
+#else
+    uint16_t *block = (uint16_t *)malloc(bytes);
+#endif
+    if (!block)
+        return false;
+    for (int i = 0; i < slotCount; i++)
+        slots[i].pixels = block + i * slotPixels;
+    return true;
+}
+
+void IconCache::draw(const PackedIcon &icon, int x, int y)
+{
+    useCount++;
+    bool haveSlots = allocate();
+
+    Slot *victim = &slots[0];
+    for (int i = 0; i < slotCount; i++)
+    {
+        Slot &slot = slots[i];
+        if (slot.icon == &icon)
+        {
+            slot.lastUse = useCount;
+            Hal::lcd->pushImage(x, y, icon.width, icon.height, slot.pixels);
+            return;
+        }
+        if (slot.lastUse < victim->lastUse)
+            victim = &slot;
+    }
+
+    // wider than the row buffer, the encoder never produces these
+    if (icon.width > maxIconSize)
+        return;
+
+    // icons taller than a slot are streamed without being cached
+    uint16_t rowBuffer[maxIconSize];
+    bool cacheable = haveSlots && icon.height <= maxIconSize;
+    if (cacheable)
+    {
+        victim->icon = &icon;
+        victim->lastUse = useCount;
+    }
+
+    IconDecoder decoder(icon);
+    Hal::lcd->startWrite();
+    for (int row = 0; row < icon.height; row++)
+    {
+        uint16_t *pixels = cacheable ? victim->pixels + row * icon.width : rowBuffer;
+        decoder.decodeRow(pixels);
+        Hal::lcd->pushImage(x, y + row, icon.width, 1, pixels);
+    }
+    Hal::lcd->endWrite();
+}
@@ -0,0 +1,171 @@
+#include "Renderer.h"
+
+uint8_t Renderer::damageCols[Renderer::maxDamage];
+uint8_t Renderer::damageRows[Renderer::maxDamage];
+int Renderer::damageCount = 0;
+bool Renderer::damageOverflow = false;
+
+int Renderer::viewLeft = 0;
+int Renderer::viewTop = 0;
+int Renderer::viewWidth = 8;
+int Renderer::viewHeight = 6;
+
+////////////////////////////////////////////////////////////////////
+// Walls
+//
+// Every tile draws half a wall on each closed side, so the boundary
+// between two tiles is made of two 5 px strips ("halves"). Walking
+// each boundary and only emitting a rect when the pair of halves
+// changes turns up to four fillRect calls per tile into one call per
+// straight wall segment.
+////////////////////////////////////////////////////////////////////
+void Renderer::fillVerticalRun(int x, int y, int rows, uint8_t halves, uint32_t color)
+{
+    // bit 0 is the right wall of the tile to the left, bit 1 the left wall of the tile to the right
+    x -= (halves & 0x1) ? halfWall : 0;
+    int w = (halves == 0x3) ? 2 * halfWall : halfWall;
+    Hal::lcd->fillRect(x, y, w, rows * floorTileLength, color);
+}
+
+void Renderer::fillHorizontalRun(int x, int y, int cols, uint8_t halves, uint32_t color)
+{
+    // bit 0 is the bottom wall of the tile above, bit 1 the top wall of the tile below
+    y -= (halves & 0x1) ? halfWall : 0;
+    int h = (halves == 0x3) ? 2 * halfWall : halfWall;
+    Hal::lcd->fillRect(x, y, cols * floorTileLength, h, color);
+}
+
+void Renderer::drawWalls(const FloorTile *tiles, int mazeWidth, int colStart, int colEnd, int rowStart, int rowEnd,
+                         int x, int y, uint32_t color)
+{
+    // vertical boundaries, boundary b sits on the left edge of column b.
+    // The first and last only get the half that belongs to a drawn tile.
+    for (int b = colStart; b <= colEnd; b++)
+    {
+        int runStart = rowStart;
+        uint8_t runHalves = 0;
+        for (int row = rowStart; row <= rowEnd; row++)
+        {
+            uint8_t halves = 0;
+            if (row < rowEnd)
+            {
+                if (b > colStart && (tileWalls(tiles[row * mazeWidth + b - 1]) & OPEN_RIGHT))
+                    halves |= 0x1;
+                if (b < colEnd && (tileWalls(tiles[row * mazeWidth + b]) & OPEN_LEFT))
+                    halves |= 0x2;
+            }
+
+            if (halves != runHalves)
+            {
+                if (runHalves)
+                    fillVerticalRun(x + (b - colStart) * floorTileLength, y + (runStart - rowStart) * floorTileLength,
+                                    row - runStart, runHalves, color);
+                runStart = row;
+                runHalves = halves;
+            }
+        }
+    }
+
+    // horizontal boundaries, boundary b sits on the top edge of row b
+    for (int b = rowStart; b <= rowEnd; b++)
+    {
+        int runStart = colStart;
+        uint8_t runHalves = 0;
+        for (int col = colStart; col <= colEnd; col++)
+        {
+            uint8_t halves = 0;
+            if (col < colEnd)
+            {
+                if (b > rowStart && (tileWalls(tiles[(b - 1) * mazeWidth + col]) & OPEN_BELOW))
+                    halves |= 0x1;
+                if (b < rowEnd && (tileWalls(tiles[b * mazeWidth + col]) & OPEN_ABOVE))
+                    halves |= 0x2;
+            }
+
+            if (halves != runHalves)
+            {
+                if (runHalves)
+                    fillHorizontalRun(x + (runStart - colStart) * floorTileLength, y + (b - rowStart) * floorTileLength,
+                                      col - runStart, runHalves, color);
+                runStart = col;
+                runHalves = halves;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+// View
+////////////////////////////////////////////////////////////////////
+void Renderer::beginView(int screenWidth, int screenHeight)
+{
+    viewWidth = screenWidth / floorTileLength;
+    viewHeight = screenHeight / floorTileLength;
+    viewLeft = 0;
+    viewTop = 0;
+}
+
+void Renderer::setView(int col, int row)
+{
+    viewLeft = col;
+    viewTop = row;
+}
+
+bool Renderer::inView(int col, int row)
+{
+    return col >= viewLeft && col < viewLeft + viewWidth && row >= viewTop && row < viewTop + viewHeight;
+}
+
+////////////////////////////////////////////////////////////////////
+// Damage list
+////////////////////////////////////////////////////////////////////
+void Renderer::markDirty(int col, int row)
+{
+    for (int i = 0; i < damageCount; i++)
+    {
+        if (damageCols[i] == col && damageRows[i] == row)
+            return;
+    }
+
+    if (damageCount == maxDamage)
+    {
+        damageOverflow = true;
+        return;
+    }
+
+    damageCols[damageCount] = col;
+    damageRows[damageCount] = row;
+    damageCount++;
+}
+
+void Renderer::clearDamage()
+{
+    damageCount = 0;
+    damageOverflow = false;
+}
+
+void Renderer::flush(TileDrawer drawTile)
+{
+    if (!hasDamage())
+        return;
+
+    Hal::lcd->startWrite();
+
+    if (damageOverflow)
+    {
+        for (int row = viewTop; row < viewTop + viewHeight; row++)
+            for (int col = viewLeft; col < viewLeft + viewWidth; col++)
+                drawTile(col, row);
+    }
+    else
+    {
+        // tiles that scrolled out of view get drawn when they come back
+        for (int i = 0; i < damageCount; i++)
+            if (inView(damageCols[i], damageRows[i]))
+                drawTile(damageCols[i], damageRows[i]);
+    }
+
+    Hal::lcd->endWrite();
+
+    clearDamage();
+}
@@ -0,0 +1,234 @@
+#include "SensorTask.h"
+
+SpscRing<SensorTask::Request, 8> SensorTask::commands;
+SpscRing<TiltSample, 16> SensorTask::tiltSamples;
+SpscRing<EnvSample, 4> SensorTask::envSamples;
+SpscRing<LightSample, 4> SensorTask::lightSamples;
+
+TiltSample SensorTask::tilt;
+bool SensorTask::haveTilt = false;
+
+TiltFilter SensorTask::tiltFilter;
+unsigned long SensorTask::nextImuMs = 0;
+bool SensorTask::envPending = false;
+bool SensorTask::lightPending = false;
+SensorTask::WatchState SensorTask::watchState = SensorTask::WATCH_OFF;
+uint16_t SensorTask::watchThreshold = 0;
+uint16_t SensorTask::watchAmbient = 0;
+unsigned long SensorTask::nextWatchCheckMs = 0;
+
+#ifdef ARDUINO
+// Core 0 also runs the WiFi/BT stacks when they are up, which we don't use
+static const int sensorTaskCore = 0;
+static const int sensorTaskPriority = 2;
+static const uint32_t sensorTaskStack = 4096;
+
+void SensorTask::taskMain(void *unused)
+{
+    TickType_t wake = xTaskGetTickCount();
+    for (;;)
+    {
+        poll();
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(pollPeriodMs));
+    }
+}
+#else
+static unsigned long nextPollMs = 0;
+#endif
+
+void SensorTask::begin()
+{
+    nextImuMs = millis();
+#ifdef ARDUINO
+    xTaskCreatePinnedToCore(taskMain, "sensors", sensorTaskStack, NULL, sensorTaskPriority, NULL, sensorTaskCore);
+#else
+    nextPollMs = millis();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////
+// Sensor side
+////////////////////////////////////////////////////////////////////
+void SensorTask::poll()
+{
+    Request request;
+    while (commands.pop(request))
+    {
+        if (request.command == REQUEST_ENV)
+        {
+            Hal::env->requestTempHumidity((EnvPrecision)request.value);
+            envPending = true;
+        }
+        else if (request.command == REQUEST_LIGHT)
+        {
+            Hal::light->requestLight();
+            lightPending = true;
+        }
+        else if (request.command == WATCH_LIGHT)
+        {
+            watchThreshold = request.value;
+            watchAmbient = 0;
+            watchState = WATCH_CALIBRATING;
+            Hal::light->requestLight();
+            lightPending = true;
+        }
+        else if (request.command == STOP_WATCHING_LIGHT && watchState != WATCH_OFF)
+        {
+            Hal::light->setAmbientAlert(0);
+            watchState = WATCH_OFF;
+        }
+    }
+
+    // queued I2C transactions that are due, including the ones just requested
+    // (SHT40 measures and results, VCNL4040 batches)
+    Hal::serviceSensors();
+
+    if ((long)(millis() - nextImuMs) >= 0)
+    {
+        nextImuMs = millis() + imuBatchMs;
+
+        // everything buffered since the last burst goes through the filter,
+        // the game only needs the result
+        AccelSample accel[16];
+        int count;
+        bool filtered = false;
+        while ((count = Hal::imu->readAccelFifo(accel, 16)) > 0)
+        {
+            for (int i = 0; i < count; i++)
+                tiltFilter.update(accel[i]);
+            filtered = true;
+            if (count < 16)
+                break;
+        }
+
+        if (filtered)
+        {
+            TiltSample tiltSample;
+            tiltSample.timeMs = millis();
+            tiltSample.accX = tiltFilter.x();
+            tiltSample.accY = tiltFilter.y();
+            tiltSample.direction = tiltFilter.direction();
+            tiltSamples.push(tiltSample);
+        }
+    }
+
+    EnvSample envSample;
+    if (envPending && Hal::env->readTempHumidity(&envSample.temperature, &envSample.humidity))
+    {
+        envSample.timeMs = millis();
+        envSamples.push(envSample);
+        envPending = false;
+    }
+
+    if (watchState == WATCH_ARMED &&
+        (Hal::light->ambientAlerted() || (long)(millis() - nextWatchCheckMs) >= 0))
+    {
+        Hal::light->requestLight();
+        lightPending = true;
+        watchState = WATCH_CONFIRMING;
+    }
+
+    LightSample lightSample;
+    if (lightPending && Hal::light->readLight(&lightSample.whiteLight, &lightSample.ambientLight))
+    {
+        lightSample.timeMs = millis();
+        lightPending = false;
+        if (watchState == WATCH_OFF)
+            lightSamples.push(lightSample);
+        else
+            watchReading(lightSample);
+    }
+}
+
+void SensorTask::watchReading(const LightSample &sample)
+{
+    if (sample.whiteLight >= watchThreshold)
+    {
+        Hal::light->setAmbientAlert(0);
+        watchState = WATCH_OFF;
+        lightSamples.push(sample);
+        return;
+    }
+
+    // only the ambient channel can interrupt, and how it compares to white
+    // depends on the light source: scale the threshold by this reading
+    uint32_t ambient = (uint32_t)watchThreshold * sample.ambientLight / (sample.whiteLight ? sample.whiteLight : 1);
+    if (ambient < 1)
+        ambient = 1;
+    if (ambient > 0xFFFF)
+        ambient = 0xFFFF;
+
+    // reprogram only when the ratio moved by more than 1/8
+    uint32_t delta = ambient > watchAmbient ? ambient - watchAmbient : watchAmbient - ambient;
+    if (watchAmbient == 0 || delta > watchAmbient / 8)
+    {
+        watchAmbient = (uint16_t)ambient;
+        Hal::light->setAmbientAlert(watchAmbient);
+    }
+    watchState = WATCH_ARMED;
+    nextWatchCheckMs = millis() + watchRecheckMs;
+}
+
+////////////////////////////////////////////////////////////////////
+// Game side
+////////////////////////////////////////////////////////////////////
+void SensorTask::update()
+{
+#ifndef ARDUINO
+    if ((long)(millis() - nextPollMs) >= 0)
+    {
+        poll();
+        nextPollMs = millis() + pollPeriodMs;
+    }
+#endif
+
+    TiltSample sample;
+    while (tiltSamples.pop(sample))
+    {
+        tilt = sample;
+        haveTilt = true;
+    }
+}
+
+bool SensorTask::latestTilt(TiltSample *sample)
+{
+    if (haveTilt)
+        *sample = tilt;
+    return haveTilt;
+}
+
+void SensorTask::requestEnv(EnvPrecision precision)
+{
+    commands.push({REQUEST_ENV, precision});
+}
+
+void SensorTask::requestLight()
+{
+    commands.push({REQUEST_LIGHT, 0});
+}
+
+void SensorTask::watchLight(uint16_t whiteThreshold)
+{
+    commands.push({WATCH_LIGHT, whiteThreshold});
+}
+
+void SensorTask::stopWatchingLight()
+{
+    commands.push({STOP_WATCHING_LIGHT, 0});
+}
+
+bool SensorTask::takeEnv(EnvSample *sample)
+{
+    bool found = false;
+    while (envSamples.pop(*sample))
+        found = true;
+    return found;
+}
+
+bool SensorTask::takeLight(LightSample *sample)
+{
+    bool found = false;
+    while (lightSamples.pop(*sample))
+        found = true;
+    return found;
+}
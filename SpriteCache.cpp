@@ -0,0 +1,52 @@
+#include "SpriteCache.h"
+#include "Canvas.h"
+
+SpriteCache::Sprite SpriteCache::sprites[SpriteCache::maxSprites];
+int SpriteCache::spriteCount = 0;
+
+SpriteCache::Sprite *SpriteCache::find(GlyphRenderer render, uint32_t color1, uint32_t color2)
+{
+    for (int i = 0; i < spriteCount; i++)
+    {
+        Sprite &sprite = sprites[i];
+        if (sprite.render == render && sprite.color1 == color1 && sprite.color2 == color2)
+            return &sprite;
+    }
+    return NULL;
+}
+
+SpriteCache::Sprite *SpriteCache::fetch(GlyphRenderer render, uint32_t color1, uint32_t color2)
+{
+    Sprite *cached = find(render, color1, color2);
+    if (cached || spriteCount == maxSprites)
+        return cached;
+
+    Sprite &sprite = sprites[spriteCount++];
+    sprite.render = render;
+    sprite.color1 = color1;
+    sprite.color2 = color2;
+
+    // rasterize the glyph on a transparent background
+    Canvas canvas(sprite.pixels, spriteSize, spriteSize);
+    canvas.clear(transparentColor);
+    render(canvas, spriteRadius, spriteRadius, color1, color2);
+    return &sprite;
+}
+
+bool SpriteCache::prepare(GlyphRenderer render, uint32_t color1, uint32_t color2)
+{
+    return fetch(render, color1, color2) != NULL;
+}
+
+void SpriteCache::draw(GlyphRenderer render, int xCenter, int yCenter, uint32_t color1, uint32_t color2)
+{
+    Sprite *sprite = fetch(render, color1, color2);
+    if (!sprite)
+    {
+        // cache is full, fall back to drawing the primitives
+        render(*Hal::lcd, xCenter, yCenter, color1, color2);
+        return;
+    }
+
+    Hal::lcd->pushImage(xCenter - spriteRadius, yCenter - spriteRadius, spriteSize, spriteSize, sprite->pixels, transparentColor);
+}
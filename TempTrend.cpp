@@ -0,0 +1,67 @@
+#include "TempTrend.h"
+
+void TempTrend::reset()
+{
+    levelMilliC = 0;
+    slopeMilliCPerS = 0;
+    lastMs = 0;
+    samples = 0;
+}
+
+void TempTrend::update(float celsius, unsigned long timeMs)
+{
+    int32_t reading = (int32_t)(celsius * 1000.0f + (celsius >= 0 ? 0.5f : -0.5f));
+    if (samples == 0)
+    {
+        levelMilliC = reading;
+        lastMs = timeMs;
+        samples = 1;
+        return;
+    }
+
+    int32_t dt = (int32_t)(timeMs - lastMs);
+    if (dt <= 0)
+        dt = 1;
+    lastMs = timeMs;
+
+    // where the trend says we should be, and how far off the reading is
+    int32_t predicted = levelMilliC + slopeMilliCPerS * dt / 1000;
+    int32_t error = reading - predicted;
+    if (error > maxStepMilliC)
+        error = maxStepMilliC;
+    else if (error < -maxStepMilliC)
+        error = -maxStepMilliC;
+
+    int32_t newLevel = predicted + (error >> levelShift);
+    int32_t observedSlope = (newLevel - levelMilliC) * 1000 / dt;
+    if (samples == 1)
+    {
+        slopeMilliCPerS = observedSlope;
+        samples = 2;
+    }
+    else
+        slopeMilliCPerS += (observedSlope - slopeMilliCPerS) >> slopeShift;
+    levelMilliC = newLevel;
+}
+
+bool TempTrend::reached(float target) const
+{
+    return samples > 0 && levelMilliC >= (int32_t)(target * 1000.0f);
+}
+
+unsigned long TempTrend::readDelayMs(float target, unsigned long minMs, unsigned long maxMs) const
+{
+    int32_t remaining = (int32_t)(target * 1000.0f) - levelMilliC;
+    if (samples < 2 || remaining <= 0)
+        return minMs;
+    if (slopeMilliCPerS <= 0)
+        return maxMs;
+
+    unsigned long etaMs = (unsigned long)((int64_t)remaining * 1000 / slopeMilliCPerS);
+    unsigned long delayMs = etaMs / 2;
+    if (delayMs < minMs)
+        return minMs;
+    if (delayMs > maxMs)
+        return maxMs;
+    return delayMs;
+}
@@ -0,0 +1,40 @@
+#include "TileAtlas.h"
+#include "Canvas.h"
+#include <stdlib.h>
+
+uint16_t *TileAtlas::atlas = NULL;
+uint8_t TileAtlas::rendered[(TileAtlas::tileCount + 7) / 8];
+TileRenderer TileAtlas::renderer = NULL;
+
+bool TileAtlas::begin(TileRenderer render)
+{
+    renderer = render;
+    if (atlas)
+        return true;
+
+    size_t bytes = (size_t)tileCount * tilePixels * sizeof(uint16_t);
+#ifdef ARDUINO
+    // far too big for internal RAM
+    atlas = (uint16_t *)ps_malloc(bytes);
+#else
+    atlas = (uint16_t *)malloc(bytes);
+#endif
+    for (int i = 0; i < (int)sizeof(rendered); i++)
+        rendered[i] = 0;
+    return atlas != NULL;
+}
+
+void TileAtlas::draw(int x, int y, uint8_t openings, uint8_t look)
+{
+    int index = look * (OPEN_MASK + 1) + (openings & OPEN_MASK);
+    uint16_t *pixels = atlas + index * tilePixels;
+
+    if (!(rendered[index / 8] & (1 << (index % 8))))
+    {
+        Canvas canvas(pixels, tileSize, tileSize);
+        renderer(canvas, openings & OPEN_MASK, look);
+        rendered[index / 8] |= 1 << (index % 8);
+    }
+
+    Hal::lcd->pushImage(x, y, tileSize, tileSize, pixels);
+}
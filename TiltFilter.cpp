@@ -0,0 +1,56 @@
+#include "TiltFilter.h"
+#include <stdlib.h>
+
+void TiltFilter::reset()
+{
+    filteredX = 0;
+    filteredY = 0;
+    primed = false;
+    current = TILT_NONE;
+}
+
+void TiltFilter::update(const AccelSample &sample)
+{
+    int32_t x = (int32_t)sample.x << fractionBits;
+    int32_t y = (int32_t)sample.y << fractionBits;
+    if (!primed)
+    {
+        filteredX = x;
+        filteredY = y;
+        primed = true;
+    }
+    else
+    {
+        filteredX += (x - filteredX) >> smoothingShift;
+        filteredY += (y - filteredY) >> smoothingShift;
+    }
+    classify();
+}
+
+void TiltFilter::classify()
+{
+    int fx = x();
+    int fy = y();
+    int ax = abs(fx);
+    int ay = abs(fy);
+
+    bool onX = current == TILT_LEFT || current == TILT_RIGHT;
+    bool onY = current == TILT_UP || current == TILT_DOWN;
+
+    // hold the current direction until its own side falls below exitMg
+    // (a flip to the opposite side doesn't count) or the other axis clearly
+    // takes over
+    int alongX = current == TILT_LEFT ? fx : -fx;
+    int alongY = current == TILT_DOWN ? fy : -fy;
+    if (onX && alongX >= exitMg && !(ay > enterMg && ay > ax + switchMarginMg))
+        return;
+    if (onY && alongY >= exitMg && !(ax > enterMg && ax > ay + switchMarginMg))
+        return;
+
+    if (ax <= enterMg && ay <= enterMg)
+        current = TILT_NONE;
+    else if (ax > ay)
+        current = fx > 0 ? TILT_LEFT : TILT_RIGHT;
+    else
+        current = fy > 0 ? TILT_DOWN : TILT_UP;
+}
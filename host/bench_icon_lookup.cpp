@@ -0,0 +1,118 @@
+/////////////////////////////////////////////////////////////////////////////
+// Micro-benchmark: weather icon lookup through the constexpr index table vs
+// the old String + startsWith() chain.
+//
+// Build from the repository root (standalone, no game sources needed):
+//   g++ -std=c++17 -O2 -Iinclude host/bench_icon_lookup.cpp -o bench_icon_lookup
+// Run:
+//   ./bench_icon_lookup [iterations]
+/////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Hal.h"
+#include "EGR425_Phase1_weather_bitmap_images.h"
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedNs(Clock::time_point since)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - since).count();
+}
+
+// Stand-in for Arduino's String: always copies the text to the heap
+class LegacyString
+{
+    public:
+        LegacyString(const char *text)
+        {
+            size_t length = strlen(text);
+            buffer = (char *)malloc(length + 1);
+            memcpy(buffer, text, length + 1);
+        }
+        ~LegacyString() { free(buffer); }
+
+        bool startsWith(const char *prefix) const
+        {
+            return strncmp(buffer, prefix, strlen(prefix)) == 0;
+        }
+
+    private:
+        char *buffer;
+};
+
+// The lookup as it was before the index table
+__attribute__((noinline)) static const uint16_t *legacyWeatherBitmap(LegacyString iconId)
+{
+    if (iconId.startsWith("01d"))
+        return i01d;
+    else if (iconId.startsWith("01n"))
+        return i01n;
+    else if (iconId.startsWith("02d"))
+        return i02d;
+    else if (iconId.startsWith("02n"))
+        return i02n;
+    else if (iconId.startsWith("03"))
+        return i03d;
+    else if (iconId.startsWith("04"))
+        return i04d;
+    else if (iconId.startsWith("09"))
+        return i09d;
+    else if (iconId.startsWith("10d"))
+        return i10d;
+    else if (iconId.startsWith("10n"))
+        return i10n;
+    else if (iconId.startsWith("11"))
+        return i11d;
+    else if (iconId.startsWith("13"))
+        return i13d;
+    else if (iconId.startsWith("50"))
+        return i50d;
+    else
+        return NULL;
+}
+
+__attribute__((noinline)) static const uint16_t *tableWeatherBitmap(const char *iconId)
+{
+    return getWeatherBitmap(iconId);
+}
+
+// Every code OpenWeather sends, plus a few it should not
+static const char *const iconCodes[] = {
+    "01d", "01n", "02d", "02n", "03d", "03n", "04d", "04n", "09d", "09n",
+    "10d", "10n", "11d", "11n", "13d", "13n", "50d", "50n", "", "7", "12d", "10x"
+};
+static const int iconCodeCount = sizeof(iconCodes) / sizeof(iconCodes[0]);
+
+int main(int argc, char **argv)
+{
+    long iterations = argc > 1 ? atol(argv[1]) : 1000000;
+
+    for (int i = 0; i < iconCodeCount; i++)
+    {
+        if (legacyWeatherBitmap(iconCodes[i]) != tableWeatherBitmap(iconCodes[i]))
+        {
+            printf("mismatch for \"%s\"\n", iconCodes[i]);
+            return 1;
+        }
+    }
+
+    // volatile sink so the lookups are not optimized away
+    volatile uintptr_t sink = 0;
+
+    Clock::time_point start = Clock::now();
+    for (long n = 0; n < iterations; n++)
+        sink = sink + (uintptr_t)legacyWeatherBitmap(iconCodes[n % iconCodeCount]);
+    double legacyNs = elapsedNs(start) / iterations;
+
+    start = Clock::now();
+    for (long n = 0; n < iterations; n++)
+        sink = sink + (uintptr_t)tableWeatherBitmap(iconCodes[n % iconCodeCount]);
+    double tableNs = elapsedNs(start) / iterations;
+
+    printf("lookup            ns/call\n");
+    printf("startsWith chain  %7.2f\n", legacyNs);
+    printf("index table       %7.2f\n", tableNs);
+    return 0;
+}
@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////
+// Micro-benchmark: procedural maze generation throughput for each algorithm
+// across grid sizes, plus a check that every generated maze is perfect
+// (every tile reachable, cells - 1 openings).
+//
+// Build from the repository root (standalone, no game sources needed):
+//   g++ -std=c++17 -O2 -Iinclude MazeGenerator.cpp host/bench_maze_gen.cpp -o bench_maze_gen
+// Run:
+//   ./bench_maze_gen [mazes per size]
+/////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include "MazeGenerator.h"
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedUs(Clock::time_point since)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - since).count();
+}
+
+static FloorTile cells[MazeGenerator::maxCells];
+
+// Flood fill from the start and count the passages (each counted from both sides)
+static bool perfect(int width, int height, const MazeLayout &layout)
+{
+    static bool seen[MazeGenerator::maxCells];
+    static int stack[MazeGenerator::maxCells];
+    int count = width * height;
+    int openings = 0;
+    for (int cell = 0; cell < count; cell++)
+    {
+        seen[cell] = false;
+        openings += __builtin_popcount(cells[cell] & OPEN_MASK);
+    }
+
+    int depth = 0;
+    int reached = 1;
+    int first = layout.startY * width + layout.startX;
+    seen[first] = true;
+    stack[depth++] = first;
+    while (depth > 0)
+    {
+        int cell = stack[--depth];
+        const int step[4] = {-1, 1, -width, width};
+        for (int direction = 0; direction < 4; direction++)
+        {
+            if (!(cells[cell] & (1 << direction)))
+                continue;
+            int next = cell + step[direction];
+            if (!seen[next])
+            {
+                seen[next] = true;
+                reached++;
+                stack[depth++] = next;
+            }
+        }
+    }
+    return reached == count && openings == 2 * (count - 1);
+}
+
+struct Size
+{
+    int width;
+    int height;
+};
+
+static const Size sizes[] = {{8, 6}, {16, 16}, {32, 32}, {64, 64}};
+static const char *const algorithmNames[] = {"backtracker", "wilson", "kruskal"};
+
+int main(int argc, char **argv)
+{
+    long mazes = argc > 1 ? atol(argv[1]) : 2000;
+
+    printf("algorithm     size    us/maze   Mcells/s\n");
+    for (int algorithm = MAZE_BACKTRACKER; algorithm <= MAZE_KRUSKAL; algorithm++)
+    {
+        for (const Size &size : sizes)
+        {
+            MazeLayout layout;
+            int count = size.width * size.height;
+
+            for (uint32_t seed = 1; seed <= 50; seed++)
+            {
+                MazeGenerator::generate(cells, size.width, size.height, seed, (MazeAlgorithm)algorithm, 5, 5, &layout);
+                if (!perfect(size.width, size.height, layout))
+                {
+                    printf("%s %dx%d seed %u is not a perfect maze\n", algorithmNames[algorithm], size.width,
+                           size.height, seed);
+                    return 1;
+                }
+            }
+
+            // scale the run down for the big grids
+            long runs = mazes * 48 / count;
+            if (runs < 20)
+                runs = 20;
+
+            Clock::time_point start = Clock::now();
+            for (long n = 0; n < runs; n++)
+                MazeGenerator::generate(cells, size.width, size.height, (uint32_t)n + 1, (MazeAlgorithm)algorithm, 5,
+                                        5, &layout);
+            double us = elapsedUs(start) / runs;
+
+            printf("%-11s %3dx%-3d %9.2f %10.2f\n", algorithmNames[algorithm], size.width, size.height, us,
+                   count / us);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+/////////////////////////////////////////////////////////////////////////////
+// Host driver: runs the game loop against the stub HAL so the frame path and
+// sensor path can be profiled (perf, valgrind, ...) without a device.
+//
+// Build from the repository root:
+//   g++ -std=c++17 -O2 -Iinclude *.cpp host/host_main.cpp -o maze_host
+// Run:
+//   ./maze_host [ticksPerLevel]
+/////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include "Maze.h"
+#include "HalHost.h"
+#include "FrameScheduler.h"
+#include "MazeSolver.h"
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedNs(Clock::time_point since)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - since).count();
+}
+
+// Tilt the device in one of the four directions (or hold it level)
+static void setTilt(int direction)
+{
+    const float tilt = 0.5; // g, well past the movement threshold
+    HalHost::accX = 0;
+    HalHost::accY = 0;
+    if (direction == 0) HalHost::accX = tilt;       // left
+    else if (direction == 1) HalHost::accX = -tilt; // right
+    else if (direction == 2) HalHost::accY = -tilt; // up
+    else if (direction == 3) HalHost::accY = tilt;  // down
+}
+
+int main(int argc, char **argv)
+{
+    long ticksPerLevel = argc > 1 ? atol(argv[1]) : 200000;
+    srand(425);
+
+    setup();
+
+    const MazeLevel levels[] = {EASY, MEDIUM, HARD, EXTREME};
+    const char *names[] = {"easy", "medium", "hard", "extreme"};
+
+    printf("%-8s %12s %6s %12s %10s %10s %10s %10s %10s %8s\n", "level", "start us", "route", "tick ns", "imu", "env",
+           "env low", "light", "overruns", "idle %");
+
+    for (int i = 0; i < 4; i++)
+    {
+        HalHost::imuReads = 0;
+        HalHost::envReads = 0;
+        HalHost::envLowReads = 0;
+        HalHost::lightReads = 0;
+
+        selectLevel(levels[i]);
+        Clock::time_point startTime = Clock::now();
+        startMaze();
+        double startNs = elapsedNs(startTime);
+
+        unsigned long levelStartMs = millis();
+        double tickNs = 0;
+        long ticks = 0;
+        for (; ticks < ticksPerLevel && currentScreenState() == MAZE; ticks++)
+        {
+            // wander around, shine light on flowers now and then (held for a few
+            // ticks, samples arrive a tick or two after a request) and warm the
+            // room steadily so every ice block eventually melts
+            if (ticks % 8 == 0)
+                setTilt(rand() % 5);
+            HalHost::whiteLight = (ticks % 64 < 4) ? 5000 : 100;
+            HalHost::ambientLight = HalHost::whiteLight * 3 / 4;
+            HalHost::temperature = 22.0 + ticks * 0.01;
+
+            Clock::time_point tickTime = Clock::now();
+            loop();
+            tickNs += elapsedNs(tickTime);
+        }
+
+        // virtual time only moves inside delay(), i.e. while idle, so the
+        // idle column is ~100% by construction and not a measurement
+        unsigned long levelMs = millis() - levelStartMs;
+        printf("%-8s %12.1f %6d %12.1f %10lu %10lu %10lu %10lu %10lu %8.1f\n", names[i], startNs / 1000.0,
+               MazeSolver::routeLength(), tickNs / ticks,
+               HalHost::imuReads, HalHost::envReads, HalHost::envLowReads, HalHost::lightReads,
+               FrameScheduler::simOverruns + FrameScheduler::frameOverruns,
+               levelMs ? 100.0 * FrameScheduler::idleMs / levelMs : 0.0);
+    }
+
+    return 0;
+}
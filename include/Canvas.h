@@ -0,0 +1,52 @@
+#ifndef CANVAS_H
+#define CANVAS_H
+
+// Includes
+#include "Hal.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Software RGB565 rasterizer. Draws into a caller supplied pixel buffer using
+// the same scan conversion as TFT_eSPI, so anything rendered here matches what
+// the LCD would show. Text calls are accepted but not rasterized.
+/////////////////////////////////////////////////////////////////////////////
+class Canvas : public HalDisplay
+{
+    public:
+        Canvas(uint16_t *pixels, int w, int h);
+
+        uint16_t *pixels() { return buffer; }
+        void setBuffer(uint16_t *pixels) { buffer = pixels; }
+        uint16_t readPixel(int x, int y);
+
+        // HalDisplay
+        int width() override { return canvasWidth; }
+        int height() override { return canvasHeight; }
+        void startWrite() override {}
+        void endWrite() override {}
+        void clear(uint32_t color) override;
+        void fillRect(int x, int y, int w, int h, uint32_t color) override;
+        void fillRoundRect(int x, int y, int w, int h, int r, uint32_t color) override;
+        void fillCircle(int x, int y, int r, uint32_t color) override;
+        void fillEllipse(int x, int y, int rx, int ry, uint32_t color) override;
+        void pushImage(int x, int y, int w, int h, const uint16_t *data) override;
+        void pushImage(int x, int y, int w, int h, const uint16_t *data, uint16_t transparent) override;
+        void setCursor(int x, int y) override;
+        void setTextColor(uint32_t color) override;
+        void setTextSize(int size) override;
+        void print(const char *text) override;
+        void println(const char *text) override;
+        void drawString(const char *text, int x, int y, int font) override;
+
+    private:
+        uint16_t *buffer;
+        int canvasWidth;
+        int canvasHeight;
+        int cursorX;
+        int cursorY;
+        int textSize;
+
+        void drawFastHLine(int x, int y, int w, uint16_t color);
+        void fillCircleHelper(int x0, int y0, int r, uint8_t corners, int delta, uint16_t color);
+};
+
+#endif
@@ -21,6 +21,8 @@
 // NOTE: All images in this library are 100x100 pixels
 /////////////////////////////////////////////////////////////////////////////
 
+#include "WeatherIconIndex.h"
+
 const int imgSqDim = 100;
 
 // '01d@2x', 100x100px
@@ -7560,37 +7562,19 @@ const uint16_t i50d [] PROGMEM = {
 	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
 };
 
+// Indexed by WeatherIconId
+const uint16_t * const weatherBitmaps[WEATHER_ICON_COUNT] = {
+    i01d, i01n, i02d, i02n, i03d, i09d, i04d, i10d, i10n, i11d, i13d, i50d
+};
+
 /////////////////////////////////////////////////////////////////////////////
-// This method takes in a String, which is parsed fromt the weather response
-// and matches it to the corresponding bitmap byte array
+// This method takes in the icon code parsed from the weather response
+// (e.g. "10d") and returns the corresponding bitmap byte array, or NULL.
+// Constant-time table lookup, pass a String with iconId.c_str().
 /////////////////////////////////////////////////////////////////////////////
-const uint16_t * getWeatherBitmap(String iconId) {
-    if (iconId.startsWith("01d"))
-        return i01d;
-    else if (iconId.startsWith("01n"))
-        return i01n;
-    else if (iconId.startsWith("02d"))
-        return i02d;
-    else if (iconId.startsWith("02n"))
-        return i02n;
-    else if (iconId.startsWith("03"))
-        return i03d;
-    else if (iconId.startsWith("04"))
-        return i04d;
-    else if (iconId.startsWith("09"))
-        return i09d;
-    else if (iconId.startsWith("10d"))
-        return i10d;
-    else if (iconId.startsWith("10n"))
-        return i10n;
-    else if (iconId.startsWith("11"))
-        return i11d;
-    else if (iconId.startsWith("13"))
-        return i13d;
-    else if (iconId.startsWith("50"))
-        return i50d;
-    else
-        return NULL;
+inline const uint16_t * getWeatherBitmap(const char *iconId) {
+    int id = weatherIconId(iconId);
+    return id == noWeatherIcon ? NULL : weatherBitmaps[id];
 }
 
 #endif
@@ -0,0 +1,65 @@
+#ifndef FRAME_BUFFER_H
+#define FRAME_BUFFER_H
+
+// Includes
+#include "Hal.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Double-buffered off-screen frame (MAZE_FRAMEBUFFER=1). All drawing goes to
+// the back buffer while the rows that changed are tracked. present() starts
+// an asynchronous push (DMA on the device) of the changed rows, swaps the
+// buffers, and copies those rows into the new back buffer so both stay in
+// sync. The next frame is composed while the push is still running.
+/////////////////////////////////////////////////////////////////////////////
+class FrameBuffer : public HalDisplay
+{
+    public:
+        // Starts pushing h full-width rows starting at row y to the panel
+        typedef void (*PushRows)(const uint16_t *rows, int y, int h);
+        // Blocks until the last push has finished reading its buffer
+        typedef void (*WaitForPush)();
+
+        FrameBuffer();
+
+        // Both buffers are width x height, pixels are the raw buffers behind the two targets
+        void begin(HalDisplay *targetA, uint16_t *pixelsA, HalDisplay *targetB, uint16_t *pixelsB,
+                   PushRows push, WaitForPush wait);
+        void present();
+
+        // HalDisplay, forwarded to the back buffer
+        int width() override { return back->width(); }
+        int height() override { return back->height(); }
+        void startWrite() override {}
+        void endWrite() override {}
+        void clear(uint32_t color) override;
+        void fillRect(int x, int y, int w, int h, uint32_t color) override;
+        void fillRoundRect(int x, int y, int w, int h, int r, uint32_t color) override;
+        void fillCircle(int x, int y, int r, uint32_t color) override;
+        void fillEllipse(int x, int y, int rx, int ry, uint32_t color) override;
+        void pushImage(int x, int y, int w, int h, const uint16_t *data) override;
+        void pushImage(int x, int y, int w, int h, const uint16_t *data, uint16_t transparent) override;
+        void setCursor(int x, int y) override;
+        void setTextColor(uint32_t color) override;
+        void setTextSize(int size) override;
+        void print(const char *text) override;
+        void println(const char *text) override;
+        void drawString(const char *text, int x, int y, int font) override;
+
+    private:
+        HalDisplay *targets[2];
+        uint16_t *pixels[2];
+        HalDisplay *back;
+        int backIndex;
+        PushRows pushRows;
+        WaitForPush waitForPush;
+
+        // rows touched since the last present, top > bottom means none
+        int dirtyTop;
+        int dirtyBottom;
+        int cursorY;
+        int textSize;
+
+        void markRows(int y, int h);
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+// Includes
+#include "Hal.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Fixed-timestep scheduler. The simulation (hat movement, ice, flowers)
+// steps at exactly one step per simPeriodMs, while input and repaint run at
+// the faster render rate. Between the two, loop() sleeps until the next
+// deadline instead of spinning, which hands the idle time back to the OS.
+//
+// Deadlines advance by whole periods so the speeds do not drift. A step
+// that is a full period late is counted as an overrun and dropped (the
+// deadline is resynced) rather than bursting several moves at once.
+/////////////////////////////////////////////////////////////////////////////
+class FrameScheduler
+{
+    public:
+        static const unsigned long defaultRenderPeriodMs = 20;
+
+        // Restarts both clocks from now
+        static void start(unsigned long simPeriodMs, unsigned long renderPeriodMs = defaultRenderPeriodMs);
+
+        // After a sleep that ran past the deadlines: counts sleptMs as idle
+        // and makes the next simulation step due in firstStepMs, without
+        // counting overruns
+        static void resume(unsigned long sleptMs, unsigned long firstStepMs);
+
+        // True once per simulation period
+        static bool simStepDue();
+
+        // Sleeps until the next simulation or render deadline
+        static void waitForNextFrame();
+
+        // Missed deadlines since start()
+        static unsigned long simOverruns;
+        static unsigned long frameOverruns;
+        // Time given back by waitForNextFrame() since start()
+        static unsigned long idleMs;
+
+    private:
+        static unsigned long simPeriod;
+        static unsigned long renderPeriod;
+        static unsigned long nextSim;
+        static unsigned long nextRender;
+};
+
+#endif
@@ -0,0 +1,239 @@
+#ifndef HAL_H
+#define HAL_H
+
+// Includes
+#include <stddef.h>
+#include <stdint.h>
+
+// Build with -DMAZE_FRAMEBUFFER=1 to compose every frame off-screen and push
+// only the changed rows (see FrameBuffer.h). 0 draws straight to the panel.
+#ifndef MAZE_FRAMEBUFFER
+#define MAZE_FRAMEBUFFER 0
+#endif
+
+#ifdef ARDUINO
+#include "Arduino.h"
+#else
+/////////////////////////////////////////////////////////////////////////////
+// Host builds have no Arduino core, so provide the handful of pieces the game
+// code relies on. millis()/delay() run on a virtual clock (see HalHost.h).
+/////////////////////////////////////////////////////////////////////////////
+unsigned long millis();
+void delay(unsigned long ms);
+
+#define PROGMEM
+
+// TFT_eSPI colour constants (RGB565)
+#define TFT_BLACK       0x0000
+#define TFT_NAVY        0x000F
+#define TFT_DARKGREEN   0x03E0
+#define TFT_DARKCYAN    0x03EF
+#define TFT_MAROON      0x7800
+#define TFT_PURPLE      0x780F
+#define TFT_OLIVE       0x7BE0
+#define TFT_LIGHTGREY   0xD69A
+#define TFT_DARKGREY    0x7BEF
+#define TFT_BLUE        0x001F
+#define TFT_GREEN       0x07E0
+#define TFT_CYAN        0x07FF
+#define TFT_RED         0xF800
+#define TFT_MAGENTA     0xF81F
+#define TFT_YELLOW      0xFFE0
+#define TFT_WHITE       0xFFFF
+#define TFT_ORANGE      0xFDA0
+#define TFT_GREENYELLOW 0xB7E0
+#define TFT_PINK        0xFE19
+
+// M5Display aliases
+#define WHITE  TFT_WHITE
+#define PINK   TFT_PINK
+#define YELLOW TFT_YELLOW
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+// Hardware abstraction layer. The game only talks to these interfaces, so the
+// same loop() runs on the M5Core2 (HalM5Core2.cpp) and on a Linux host
+// (HalHost.cpp) where the frame and sensor paths can be profiled.
+/////////////////////////////////////////////////////////////////////////////
+
+class HalDisplay
+{
+    public:
+        virtual ~HalDisplay() {}
+
+        virtual int width() = 0;
+        virtual int height() = 0;
+
+        // Hold the SPI bus (and chip select) across several draw calls
+        virtual void startWrite() = 0;
+        virtual void endWrite() = 0;
+
+        // Drawing primitives (same semantics as M5.Lcd / TFT_eSPI)
+        virtual void clear(uint32_t color) = 0;
+        virtual void fillRect(int x, int y, int w, int h, uint32_t color) = 0;
+        virtual void fillRoundRect(int x, int y, int w, int h, int r, uint32_t color) = 0;
+        virtual void fillCircle(int x, int y, int r, uint32_t color) = 0;
+        virtual void fillEllipse(int x, int y, int rx, int ry, uint32_t color) = 0;
+
+        // Blits a w x h block of native-endian RGB565 pixels, optionally
+        // skipping every pixel equal to the transparent colour
+        virtual void pushImage(int x, int y, int w, int h, const uint16_t *data) = 0;
+        virtual void pushImage(int x, int y, int w, int h, const uint16_t *data, uint16_t transparent) = 0;
+
+        // Text
+        virtual void setCursor(int x, int y) = 0;
+        virtual void setTextColor(uint32_t color) = 0;
+        virtual void setTextSize(int size) = 0;
+        virtual void print(const char *text) = 0;
+        virtual void println(const char *text) = 0;
+        virtual void drawString(const char *text, int x, int y, int font) = 0;
+};
+
+// One accelerometer reading in milli-g, same axes as HalImu::getAccelData
+struct AccelSample
+{
+    int16_t x;
+    int16_t y;
+    int16_t z;
+};
+
+class HalImu
+{
+    public:
+        virtual ~HalImu() {}
+
+        // Acceleration in g, same axes as M5.IMU.getAccelData
+        virtual void getAccelData(float *accX, float *accY, float *accZ) = 0;
+
+        // Drains up to maxSamples buffered readings (oldest first) in one
+        // bus burst. The sensor samples at accelFifoRateHz on its own, so
+        // the caller only needs to come back before the buffer fills.
+        static const int accelFifoRateHz = 100;
+        virtual int readAccelFifo(AccelSample *samples, int maxSamples) = 0;
+};
+
+// SHT40 repeatability modes: coarser readings convert faster
+enum EnvPrecision : uint8_t
+{
+    ENV_LOW_PRECISION,      // 0.10 C repeatability, 1.6 ms
+    ENV_MEDIUM_PRECISION,   // 0.07 C, 4.5 ms
+    ENV_HIGH_PRECISION      // 0.04 C, 8.3 ms
+};
+
+class HalEnvSensor
+{
+    public:
+        virtual ~HalEnvSensor() {}
+
+        // Temperature in degrees C, relative humidity in %. Blocks for the
+        // whole conversion (about 9 ms at high precision).
+        virtual void getTempHumidity(float *temperature, float *humidity) = 0;
+
+        // Non-blocking pair: request() starts a conversion and returns at
+        // once, superseding any still in flight. read() returns true (once)
+        // when the latest requested result is available.
+        virtual void requestTempHumidity(EnvPrecision precision) = 0;
+        virtual bool readTempHumidity(float *temperature, float *humidity) = 0;
+};
+
+class HalLightSensor
+{
+    public:
+        virtual ~HalLightSensor() {}
+
+        virtual uint16_t getWhiteLight() = 0;
+
+        // Non-blocking pair, same contract as the environment sensor. Both
+        // channels are fetched in one bus transaction.
+        virtual void requestLight() = 0;
+        virtual bool readLight(uint16_t *whiteLight, uint16_t *ambientLight) = 0;
+
+        // Threshold alert on the ambient (ALS) channel, which is the one
+        // with interrupt support. set() programs the sensor to flag once
+        // the ambient reading rises above ambientThreshold (0 disables it),
+        // alerted() returns true once per crossing. Backends without an
+        // interrupt line poll for it while a threshold is set.
+        virtual void setAmbientAlert(uint16_t ambientThreshold) = 0;
+        virtual bool ambientAlerted() = 0;
+};
+
+class HalSpeaker
+{
+    public:
+        virtual ~HalSpeaker() {}
+
+        virtual void dingDong() = 0;
+};
+
+// CPU policy, see Hal::setPowerProfile()
+enum PowerProfile
+{
+    POWER_INTERACTIVE,  // MAZE: up to 240 MHz, no light sleep
+    POWER_STATIC        // START/INSTRUCTIONS/END: 80 MHz cap, light sleep allowed
+};
+
+class Hal
+{
+    public:
+        // Members (filled in by begin() of whichever backend is compiled in)
+        static HalDisplay *lcd;
+        static HalImu *imu;
+        static HalEnvSensor *env;
+        static HalLightSensor *light;
+        static HalSpeaker *spk;
+
+        // Initialization and per-loop housekeeping (touch, buttons, queued I2C)
+        static void begin();
+        static void update();
+
+        // Runs queued sensor bus work, called by whoever owns the sensors
+        // (the sensor task, see SensorTask.h)
+        static void serviceSensors();
+
+        // Shows what was drawn since the last call (no-op in immediate mode)
+        static void present();
+
+        // Hardware vertical scroll: screen line y shows panel row
+        // (lines + y) % height, drawing still addresses panel rows. In
+        // framebuffer mode it takes effect at present(), once the rows drawn
+        // for it are on the panel.
+        static void scrollVertically(int lines);
+
+        // Power management. The profile is cheap to set every loop. Hold
+        // full speed only around the actual work of a frame.
+        static void setPowerProfile(PowerProfile profile);
+        static void holdFullSpeed(bool hold);
+
+        // Light-sleeps until the screen is touched or maxMs pass. Returns
+        // false right away (without sleeping) while the user is interacting.
+        static bool sleepUntilTouch(unsigned long maxMs);
+
+        // Same, but also woken early when the accelerometer sees a jolt.
+        // For a maze whose hat sits level and still. A slow tilt doesn't
+        // trip the sensor's motion detector and is only noticed once maxMs
+        // pass, so keep maxMs to the longest acceptable input latency.
+        static bool sleepUntilMotion(unsigned long maxMs);
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// Blends two RGB565 colours, matches TFT_eSPI::alphaBlend so both backends
+// produce the same pixels.
+/////////////////////////////////////////////////////////////////////////////
+inline uint16_t alphaBlend565(uint8_t alpha, uint16_t fgc, uint16_t bgc)
+{
+    uint16_t fgR = ((fgc >> 10) & 0x3E) + 1;
+    uint16_t fgG = ((fgc >> 4) & 0x7E) + 1;
+    uint16_t fgB = ((fgc << 1) & 0x3E) + 1;
+
+    uint16_t bgR = ((bgc >> 10) & 0x3E) + 1;
+    uint16_t bgG = ((bgc >> 4) & 0x7E) + 1;
+    uint16_t bgB = ((bgc << 1) & 0x3E) + 1;
+
+    uint16_t r = (((fgR * alpha) + (bgR * (255 - alpha))) >> 9);
+    uint16_t g = (((fgG * alpha) + (bgG * (255 - alpha))) >> 9);
+    uint16_t b = (((fgB * alpha) + (bgB * (255 - alpha))) >> 9);
+
+    return (r << 11) | (g << 5) | (b << 0);
+}
+
+#endif
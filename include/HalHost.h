@@ -0,0 +1,46 @@
+#ifndef HAL_HOST_H
+#define HAL_HOST_H
+
+// Includes
+#include "Canvas.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Knobs for the Linux stub backend. The host driver uses these to script the
+// sensors and the virtual clock while it runs the game loop.
+/////////////////////////////////////////////////////////////////////////////
+class HalHost
+{
+    public:
+        // Sensor inputs returned by the stubs
+        static float accX;          // g, positive tilts left
+        static float accY;          // g, positive tilts down
+        static float accZ;
+        static float temperature;   // degrees C
+        static float humidity;      // %
+        static uint16_t whiteLight;
+        static uint16_t ambientLight;
+
+        // Simulated sensor conversion times. Blocking reads charge them to
+        // the virtual clock, requested reads become ready after them.
+        static unsigned long envReadMs;     // high precision
+        static unsigned long envLowReadMs;
+        static unsigned long lightReadMs;
+
+        // Call counters, handy for regression benchmarks
+        static unsigned long imuReads;
+        static unsigned long envReads;
+        static unsigned long envLowReads;   // requests at low precision
+        static unsigned long lightReads;
+        static unsigned long dingDongs;
+
+        // Virtual clock behind millis()/delay()
+        static void advanceMillis(unsigned long ms);
+
+        // The 320x240 screen the stub display renders into, shown starting
+        // at row scrollLines (see Hal::scrollVertically)
+        static Canvas &screen();
+        static int scrollLines;
+        static unsigned long scrolls;
+};
+
+#endif
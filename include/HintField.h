@@ -0,0 +1,47 @@
+#ifndef HINT_FIELD_H
+#define HINT_FIELD_H
+
+// Includes
+#include "Maze.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Distance fields behind the hint overlay: steps from every tile to the
+// nearest flower bud and to the end, built once per level. A hint is then a
+// look at the four neighbours for one that is a step closer, no search.
+//
+// When a bud blooms only the tiles that had it as their nearest bud are
+// stale. bloom() forgets just those and refills them from the surrounding
+// tiles, whose distances still hold (removing a bud can't bring any other
+// bud closer).
+/////////////////////////////////////////////////////////////////////////////
+class HintField
+{
+    public:
+        static const int maxCells = 64 * 64;
+
+        // Builds both fields for a row-major maze
+        static void build(const FloorTile *cells, int width, int height, int endX, int endY);
+
+        // The bud at col, row bloomed, repair the flower field around it
+        static void bloom(int col, int row);
+
+        // Opening (OPEN_LEFT ...) that leads one step closer to the nearest
+        // bud, or to the end; 0 when already there or there's no way
+        static uint8_t hint(int col, int row, bool toEnd);
+
+    private:
+        static const uint16_t UNREACHED = 0xFFFF;
+
+        static const FloorTile *grid;
+        static int gridWidth;
+        static int gridHeight;
+
+        static uint16_t flowerDistance[maxCells];
+        static uint16_t nearestFlower[maxCells];    // the bud flowerDistance counts to
+        static uint16_t endDistance[maxCells];
+        static uint16_t queue[maxCells];
+
+        static void spread(uint16_t *distance, int seedCount);
+};
+
+#endif
@@ -4,27 +4,219 @@
 // Includes
 #include "Arduino.h"
 #include <Wire.h>    // I2C library
+#include "SpscRing.h"
+
+// Compile-time log level: 0 nothing, 1 failures, 2 also verbose accesses
+#ifndef I2C_LOG_LEVEL
+#define I2C_LOG_LEVEL 1
+#endif
+
+// SHT40 measurement commands (no heater)
+#define SHT40_MEASURE_HIGH_PRECISION    0xFD
+#define SHT40_MEASURE_MEDIUM_PRECISION  0xF6
+#define SHT40_MEASURE_LOW_PRECISION     0xE0
+
+// VCNL4040 command codes (16-bit registers, LSB first)
+#define VCNL4040_ALS_CONF       0x00
+#define VCNL4040_ALS_THDH       0x01
+#define VCNL4040_ALS_THDL       0x02
+#define VCNL4040_PS_MS          0x04
+#define VCNL4040_ALS_DATA       0x09
+#define VCNL4040_WHITE_DATA     0x0A
+#define VCNL4040_INT_FLAG       0x0B    // read clears
+
+// Bits in those registers
+#define VCNL4040_ALS_INT_EN     0x0002  // ALS_CONF
+#define VCNL4040_ALS_IF_H       0x1000  // INT_FLAG, ALS rose above ALS_THDH
+
+// State of a queued request
+enum I2cStatus
+{
+    I2C_IDLE,       // nothing requested (or the result was already taken)
+    I2C_QUEUED,     // waiting in the queue or for the sensor to finish
+    I2C_DONE,       // result ready to be taken
+    I2C_FAILED      // NACK, short read or bad CRC
+};
+
+// Scheduling classes of queued transactions, most urgent first. The IMU
+// and touch don't queue: they use the blocking accesses, ordered by the
+// bus lock (see lockBus)
+enum I2cPriority : uint8_t
+{
+    I2C_PRIORITY_INPUT,         // light watch (the player shining a light)
+    I2C_PRIORITY_ENVIRONMENT    // temperature and humidity
+};
+
+// Traffic one device has seen since initI2C()
+struct I2cDeviceStats
+{
+    uint8_t bus;                // 0 = Wire (Port A), 1 = Wire1 (internal)
+    uint8_t address;            // 0 collects unknown addresses on that bus
+    unsigned long transactions; // times the bus was taken for it (a batch is one)
+    unsigned long failures;
+    unsigned long bytes;        // payload, where known
+    unsigned long busyUs;       // time the bus was held for this device
+};
+
+// Names an I2C action in the log. Only binds to string literals, so tagging
+// an access never copies or allocates.
+struct I2cTag
+{
+    template <size_t N>
+    constexpr I2cTag(const char (&text)[N]) : name(text) {}
+
+    const char * name;
+};
 
 class I2C_RW
 {
     public:
         // Members
         static int i2cVcnl4040Address;  // Will only be changed in testing to confirm address
-        static int i2cSht40Address; 
+        static int i2cSht40Address;
         static int i2cFrequency;
         static int i2cSdaPin;
         static int i2cSclPin;
 
-        // Initialization and debugging methods
+        // Initialization and debugging methods. initI2C() also sets up the
+        // bus locks and counters for both buses, call it before any traffic.
         static void initI2C(int i2cVcnl4040Addr, int i2cSht40ddr, int i2cFreq, int pinSda, int pinScl);
         static void scanI2cLinesForAddresses(bool verboseConnectionFailures);
         static void printI2cReturnStatus(byte returnStatus, int bytesWritten, const char action[]);
-        
-        // 8-bit register methods
+
+        // Prints up to maxEntries queued log lines, call outside the sensor path
+        static void drainLog(int maxEntries);
+
+        // Bus scheduling across tasks. Every transfer on a bus holds that
+        // bus's lock, whichever task issues it; a contended FreeRTOS mutex
+        // goes to the highest-priority waiting task, so the sensor task
+        // (IMU) gets in ahead of the loop task (touch). unlockBus() charges
+        // the time the lock was held to address. Locks don't nest.
+        static void lockBus(TwoWire &bus);
+        static void unlockBus(TwoWire &bus, uint8_t address, int bytes, bool ok);
+
+        // Takes both bus locks without charging anyone, so no transfer is
+        // in flight (or can start) while the clocks are gated in a light
+        // sleep. Nothing else may be held by the caller.
+        static void holdBuses();
+        static void releaseBuses();
+
+        // Blocking 8-bit register access to any device on either bus
+        static bool readRegisters(TwoWire &bus, uint8_t address, uint8_t reg, uint8_t * bytes, int length,
+                                  I2cTag action);
+        static bool writeRegister(TwoWire &bus, uint8_t address, uint8_t reg, uint8_t value, I2cTag action);
+
+        // Per-device utilization
+        static int busStats(const I2cDeviceStats ** stats);
+        static void printBusStats();
+
+        // 8-bit register methods (blocking). Verbose is a compile-time switch:
+        // the quiet versions contain no logging code at all.
         static void getSht40Data(byte regAddr, float * temperature, float * humidity);
-        static uint16_t readReg8Addr16Data(byte regAddr, int numBytesToRead, String action, bool verbose);
-        static bool writeReg8Addr16DataWithProof(byte regAddr, int numBytesToWrite, uint16_t data, String action, bool verbose);
-        static void writeReg8Addr16Data(byte regAddr, uint16_t data, String action, bool verbose);
+        template <bool Verbose = false>
+        static uint16_t readReg8Addr16Data(byte regAddr, int numBytesToRead, I2cTag action);
+        template <bool Verbose = false>
+        static bool writeReg8Addr16DataWithProof(byte regAddr, int numBytesToWrite, uint16_t data, I2cTag action);
+        template <bool Verbose = false>
+        static void writeReg8Addr16Data(byte regAddr, uint16_t data, I2cTag action);
+
+        // Non-blocking transaction engine. Requests only queue transactions
+        // and return at once, service() (called every loop) runs the ones
+        // that are due, and results are taken on a later tick. Due
+        // transactions run most urgent class first (the light watch ahead
+        // of the SHT40), each under its own hold of the bus lock, and a
+        // device's own transactions stay in order.
+        static void service();
+
+        // SHT40: sends the measure command on the next service() and reads
+        // the 6 result bytes once the conversion time has passed since it
+        // went out (the sensor NACKs reads until then). Fails if one is in
+        // flight.
+        static bool queueSht40Measurement(byte command);
+        static I2cStatus takeSht40Data(float * temperature, float * humidity);
+
+        // VCNL4040: reads up to maxBatchRegs registers back to back in one
+        // hold of the bus. Each register is its own write + repeated start +
+        // read, ended by a STOP (arduino-esp32 always stops after a read).
+        // Only one batch is in flight at a time.
+        static bool queueVcnl4040Reads(const byte * regAddrs, int count);
+        static I2cStatus takeVcnl4040Data(uint16_t * data, int count);
+
+    private:
+        enum TransactionType
+        {
+            WRITE_COMMAND,      // write length bytes
+            READ_BYTES,         // read length bytes
+            READ_REGISTERS      // write reg, repeated start, read 2 bytes; length times
+        };
+
+        struct Transaction
+        {
+            TransactionType type;
+            I2cPriority priority;
+            const char * tag;
+            TwoWire * bus;
+            uint8_t address;
+            uint8_t length;
+            uint8_t bytes[4];           // command bytes or register addresses
+            uint8_t * readBuffer;
+            I2cStatus * status;         // updated when this transaction finishes, may be NULL
+            unsigned long notBeforeUs;  // held back until micros() reaches this
+            unsigned long settleUs;     // the request's next step waits this long after this one
+        };
+
+        static const int maxTransactions = 8;
+        static const int busCount = 2;
+        static const int maxDevices = 7;
+        static const int maxBatchRegs = 4;
+        static Transaction queue[maxTransactions];
+        static int queueCount;
+
+        // Results waiting to be taken
+        static I2cStatus sht40Status;
+        static uint8_t sht40Raw[6];
+        static I2cStatus vcnl4040Status;
+        static uint8_t vcnl4040Raw[2 * maxBatchRegs];
+        static int vcnl4040Count;
+
+        // Log lines are recorded raw and only formatted by drainLog()
+        struct LogEntry
+        {
+            const char * tag;
+            unsigned long timeUs;
+            uint16_t data;          // value read or written
+            uint8_t returnStatus;   // Wire status, 0xFF for short read / bad CRC
+            uint8_t bytes;
+        };
+
+        // Log levels and the non-Wire statuses a LogEntry can carry
+        static const int logFailures = 1;
+        static const int logAccesses = 2;
+        static const uint8_t statusShortRead = 0xFF;
+        static const uint8_t statusBadCrc = 0xFE;
+        static const uint8_t statusMismatch = 0xFD;
+
+        static SpscRing<LogEntry, 32> logRing;
+        static portMUX_TYPE logProducers;   // either task may push
+        static std::atomic<unsigned long> logDropped;
+
+        template <int Level>
+        static void log(const char * tag, uint8_t returnStatus, int bytes, uint16_t data);
+
+        // Bus locks and counters
+        static SemaphoreHandle_t busLocks[busCount];
+        static unsigned long lockedAtUs[busCount];
+        static I2cDeviceStats deviceStats[maxDevices];
+        static unsigned long statsSinceUs;
+        static int busIndex(const TwoWire &bus) { return &bus == &Wire1 ? 1 : 0; }
+
+        static bool enqueue(const Transaction &transaction);
+        static bool isQueued(const I2cStatus * status);
+        static uint8_t run(const Transaction &transaction);
+        static bool waitsBehind(int index, const bool * handled);
+        static void finish(int index, uint8_t returnStatus);
+        static unsigned long sht40ConversionUs(byte command);
+        static bool decodeSht40(const uint8_t * raw, float * temperature, float * humidity);
 };
 
-#endif
\ No newline at end of file
+#endif
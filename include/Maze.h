@@ -0,0 +1,80 @@
+#ifndef MAZE_H
+#define MAZE_H
+
+// Includes
+#include "Hal.h"
+
+// state things
+enum ScreenState
+{
+    START,
+    INSTRUCTIONS,
+    MAZE,
+    END
+};
+
+// floor types
+enum FloorType
+{
+    FLOWER,
+    ICE,
+    WALKABLE,
+    BLOOMED,
+    STARTTILE
+};
+
+// floor tile, packed into one byte:
+//   bits 0-3  openings, set means there is no wall and you can move that way
+//   bits 4-6  FloorType
+typedef uint8_t FloorTile;
+
+const uint8_t OPEN_LEFT = 0x01;
+const uint8_t OPEN_RIGHT = 0x02;
+const uint8_t OPEN_ABOVE = 0x04;
+const uint8_t OPEN_BELOW = 0x08;
+const uint8_t OPEN_MASK = 0x0F;
+const uint8_t FLOOR_SHIFT = 4;
+const uint8_t FLOOR_MASK = 0x70;
+
+inline FloorType tileFloor(FloorTile tile)
+{
+    return (FloorType)((tile & FLOOR_MASK) >> FLOOR_SHIFT);
+}
+
+inline FloorTile withFloor(FloorTile tile, FloorType floor)
+{
+    return (tile & ~FLOOR_MASK) | (floor << FLOOR_SHIFT);
+}
+
+// walls are the openings that are not set
+inline uint8_t tileWalls(FloorTile tile)
+{
+    return ~tile & OPEN_MASK;
+}
+
+// tile geometry in pixels: each tile is a floor square with half a wall on every side
+const int halfWall = 5;
+const int floorLength = 30;
+const int floorTileLength = 40;
+
+// maze levels
+enum MazeLevel
+{
+    EASY,
+    MEDIUM,
+    HARD,
+    EXTREME
+};
+
+////////////////////////////////////////////////////////////////////
+// Game entry points (main.cpp). The touch handlers call these on the
+// device, the host driver calls them directly.
+////////////////////////////////////////////////////////////////////
+void setup();
+void loop();
+void selectLevel(MazeLevel level);
+void startMaze();
+void toggleHints();
+ScreenState currentScreenState();
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef MAZE_FORMAT_H
+#define MAZE_FORMAT_H
+
+// Includes
+#include "Maze.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Maze levels are written as ASCII art and turned into packed tables by the
+// constexpr parser below, so they end up as const data in flash and adding a
+// level needs no code. A W x H maze is (2H + 1) lines of (2W + 1) characters,
+// written as one string literal without newlines:
+//
+//      +-+-+-+      '+'        corner (ignored)
+//      |S . F|      '-' '|'    wall,  ' ' opening
+//      + +-+ +      '.'        walkable floor
+//      |I . E|      'F' 'I'    flower bud, ice block
+//      +-+-+-+      'S' 'E'    start tile, end tile (walkable)
+//
+// Each cell is packed the same way as a FloorTile (see Maze.h), so loading a
+// level is a straight copy.
+/////////////////////////////////////////////////////////////////////////////
+
+constexpr uint8_t packCell(uint8_t openings, FloorType floor)
+{
+    return (openings & OPEN_MASK) | (floor << FLOOR_SHIFT);
+}
+
+// A parsed level, lives in flash
+template <int W, int H>
+struct MazeLevelData
+{
+    uint8_t startX;
+    uint8_t startY;
+    uint8_t endX;
+    uint8_t endY;
+    uint8_t flowersToBloom;
+    uint8_t cells[H][W];
+};
+
+// Size-erased view used by the level table
+struct MazeLevelView
+{
+    uint8_t width;
+    uint8_t height;
+    uint8_t startX;
+    uint8_t startY;
+    uint8_t endX;
+    uint8_t endY;
+    uint8_t flowersToBloom;
+    const uint8_t *cells; // width * height packed cells, row major
+};
+
+////////////////////////////////////////////////////////////////////
+// Parser helpers
+////////////////////////////////////////////////////////////////////
+constexpr char mazeArtAt(const char *art, int w, int line, int col)
+{
+    return art[line * (2 * w + 1) + col];
+}
+
+constexpr bool isMazeFloorChar(char c)
+{
+    return c == '.' || c == 'F' || c == 'I' || c == 'S' || c == 'E';
+}
+
+// Checks the art is the right size, fully walled in, and has one start and one end
+template <int W, int H, int N>
+constexpr bool mazeArtValid(const char (&art)[N])
+{
+    if (N - 1 != (2 * W + 1) * (2 * H + 1))
+        return false;
+
+    int starts = 0;
+    int ends = 0;
+    for (int line = 0; line < 2 * H + 1; line++)
+    {
+        for (int col = 0; col < 2 * W + 1; col++)
+        {
+            char c = mazeArtAt(art, W, line, col);
+            bool border = line == 0 || line == 2 * H || col == 0 || col == 2 * W;
+
+            if (line % 2 == 0 && col % 2 == 0)
+            {
+                if (c != '+')
+                    return false;
+            }
+            else if (line % 2 == 1 && col % 2 == 1)
+            {
+                if (!isMazeFloorChar(c))
+                    return false;
+                starts += c == 'S';
+                ends += c == 'E';
+            }
+            else if (c != ' ' || border)
+            {
+                char wall = (line % 2 == 0) ? '-' : '|';
+                if (c != wall)
+                    return false;
+            }
+        }
+    }
+    return starts == 1 && ends == 1;
+}
+
+template <int W, int H, int N>
+constexpr MazeLevelData<W, H> parseMaze(const char (&art)[N], int flowersToBloom)
+{
+    MazeLevelData<W, H> level = {};
+    level.flowersToBloom = flowersToBloom;
+
+    for (int row = 0; row < H; row++)
+    {
+        for (int col = 0; col < W; col++)
+        {
+            int line = 2 * row + 1;
+            int x = 2 * col + 1;
+
+            uint8_t openings = 0;
+            if (mazeArtAt(art, W, line, x - 1) == ' ')
+                openings |= OPEN_LEFT;
+            if (mazeArtAt(art, W, line, x + 1) == ' ')
+                openings |= OPEN_RIGHT;
+            if (mazeArtAt(art, W, line - 1, x) == ' ')
+                openings |= OPEN_ABOVE;
+            if (mazeArtAt(art, W, line + 1, x) == ' ')
+                openings |= OPEN_BELOW;
+
+            FloorType floor = WALKABLE;
+            char c = mazeArtAt(art, W, line, x);
+            if (c == 'F')
+                floor = FLOWER;
+            else if (c == 'I')
+                floor = ICE;
+            else if (c == 'S')
+            {
+                floor = STARTTILE;
+                level.startX = col;
+                level.startY = row;
+            }
+            else if (c == 'E')
+            {
+                level.endX = col;
+                level.endY = row;
+            }
+
+            level.cells[row][col] = packCell(openings, floor);
+        }
+    }
+    return level;
+}
+
+template <int W, int H>
+constexpr MazeLevelView mazeLevelView(const MazeLevelData<W, H> &level)
+{
+    return {W, H, level.startX, level.startY, level.endX, level.endY, level.flowersToBloom, &level.cells[0][0]};
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef MAZE_GENERATOR_H
+#define MAZE_GENERATOR_H
+
+// Includes
+#include "Maze.h"
+
+// Build with -DMAZE_PROCEDURAL=1 to play freshly generated mazes instead of
+// the hand-made levels in MazeLevels.h
+#ifndef MAZE_PROCEDURAL
+#define MAZE_PROCEDURAL 0
+#endif
+
+// Spanning-tree algorithms, they give mazes of different character
+enum MazeAlgorithm : uint8_t
+{
+    MAZE_BACKTRACKER,   // long winding corridors, few dead ends
+    MAZE_WILSON,        // uniform over all mazes, many short dead ends
+    MAZE_KRUSKAL        // random edge order with union-find, lots of branching
+};
+
+// Where the generator put the start, the end and how many flowers count
+struct MazeLayout
+{
+    uint8_t width;
+    uint8_t height;
+    uint8_t startX;
+    uint8_t startY;
+    uint8_t endX;
+    uint8_t endY;
+    uint8_t flowersToBloom;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// Seeded procedural maze generator. Carves a perfect maze (exactly one path
+// between any two tiles) into a row-major FloorTile array of any size up to
+// maxCells, then places the start, the end (the tile farthest from the
+// start), flower buds (dead ends first) and ice blocks. The same seed,
+// size and algorithm always give the same maze.
+//
+// All scratch space is static, nothing is allocated, and a generate() call
+// is linear in the number of tiles (Kruskal adds a near-constant union-find
+// factor; Wilson's random walks are linear on average).
+/////////////////////////////////////////////////////////////////////////////
+class MazeGenerator
+{
+    public:
+        static const int maxCells = 64 * 64;
+
+        // False (and cells untouched) if the size is out of range or the
+        // items don't fit
+        static bool generate(FloorTile *cells, int width, int height, uint32_t seed, MazeAlgorithm algorithm,
+                             int flowers, int ices, MazeLayout *layout);
+
+    private:
+        // cell bit 7 is free in a FloorTile, it marks visited / in-tree
+        // cells while carving
+        static const uint8_t MARK = 0x80;
+
+        static FloorTile *grid;
+        static int gridWidth;
+        static int gridHeight;
+        static uint32_t rngState;
+
+        // Scratch: stack, walk directions, BFS queue / union-find parents,
+        // and the edge list / BFS distances
+        static uint16_t cellScratch[maxCells];
+        static uint16_t edgeScratch[2 * maxCells];
+
+        static uint32_t nextRandom();
+        static int randomBelow(int n);
+
+        static void carve(int cell, int direction);
+        static int neighbour(int cell, int direction);
+
+        static void backtracker();
+        static void wilson();
+        static void kruskal();
+        static int findRoot(int cell);
+
+        static int farthestFrom(int cell);
+        static void placeItems(int start, int end, int flowers, int ices);
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef MAZE_LEVELS_H
+#define MAZE_LEVELS_H
+
+// Includes
+#include "MazeFormat.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Hand-made maze levels, see MazeFormat.h for the art format. To add a level,
+// add its art, parse it, and list it in mazeLevels[].
+/////////////////////////////////////////////////////////////////////////////
+
+// Easy
+constexpr char easyMazeArt[] =
+    "+-+-+-+-+-+-+-+-+"
+    "|F . .|S|I . .|F|"
+    "+-+ + + + +-+ + +"
+    "|. .|.|.|. .|.|.|"
+    "+ +-+ + +-+ + + +"
+    "|. .|.|. . .|. .|"
+    "+-+ + +-+-+-+ +-+"
+    "|.|I|. . . . . .|"
+    "+ + +-+-+-+ +-+-+"
+    "|F|. .|F .|.|. .|"
+    "+ + + +-+ + + + +"
+    "|. .|. . E|I .|F|"
+    "+-+-+-+-+-+-+-+-+";
+static_assert(mazeArtValid<8, 6>(easyMazeArt), "easy maze art is malformed");
+constexpr MazeLevelData<8, 6> easyMaze = parseMaze<8, 6>(easyMazeArt, 5);
+
+// Medium
+constexpr char mediumMazeArt[] =
+    "+-+-+-+-+-+-+-+-+"
+    "|. . F|S|F . . .|"
+    "+ + +-+ +-+-+ + +"
+    "|.|I|. .|. .|F|.|"
+    "+ + + +-+ + +-+ +"
+    "|.|.|I . .|. . .|"
+    "+ + +-+-+-+-+-+ +"
+    "|.|F|. . . . .|.|"
+    "+ +-+ +-+-+ + + +"
+    "|I|. F|. .|.|F|I|"
+    "+ + +-+ + + +-+ +"
+    "|. . . .|E|. . .|"
+    "+-+-+-+-+-+-+-+-+";
+static_assert(mazeArtValid<8, 6>(mediumMazeArt), "medium maze art is malformed");
+constexpr MazeLevelData<8, 6> mediumMaze = parseMaze<8, 6>(mediumMazeArt, 6);
+
+// Hard
+constexpr char hardMazeArt[] =
+    "+-+-+-+-+-+-+-+-+"
+    "|. I|F S|. . . .|"
+    "+ + +-+ + +-+-+ +"
+    "|.|.|. .|. I|F .|"
+    "+ + + +-+-+ +-+-+"
+    "|.|. .|. . .|. .|"
+    "+ +-+-+ +-+ + + +"
+    "|.|F . I|. .|.|.|"
+    "+ +-+-+-+ +-+ + +"
+    "|I .|. .|. . F|.|"
+    "+ + + + +-+-+-+ +"
+    "|F|. .|. E I . F|"
+    "+-+-+-+-+-+-+-+-+";
+static_assert(mazeArtValid<8, 6>(hardMazeArt), "hard maze art is malformed");
+constexpr MazeLevelData<8, 6> hardMaze = parseMaze<8, 6>(hardMazeArt, 5);
+
+// Extreme
+constexpr char extremeMazeArt[] =
+    "+-+-+-+-+-+-+-+-+"
+    "|F|. . S|. I|. .|"
+    "+ + + +-+ + + + +"
+    "|. I|. .|.|. I|F|"
+    "+-+-+-+ + +-+ +-+"
+    "|. I|F|.|. F|. .|"
+    "+ + + + +-+-+-+ +"
+    "|.|.|.|I . .|. .|"
+    "+ + + +-+-+ + +-+"
+    "|.|. .|F|. .|. .|"
+    "+ +-+-+ + +-+-+ +"
+    "|F . . I E . . F|"
+    "+-+-+-+-+-+-+-+-+";
+static_assert(mazeArtValid<8, 6>(extremeMazeArt), "extreme maze art is malformed");
+constexpr MazeLevelData<8, 6> extremeMaze = parseMaze<8, 6>(extremeMazeArt, 5);
+
+// Indexed by MazeLevel
+constexpr MazeLevelView mazeLevels[] = {
+    mazeLevelView(easyMaze),
+    mazeLevelView(mediumMaze),
+    mazeLevelView(hardMaze),
+    mazeLevelView(extremeMaze),
+};
+
+#endif
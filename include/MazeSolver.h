@@ -0,0 +1,77 @@
+#ifndef MAZE_SOLVER_H
+#define MAZE_SOLVER_H
+
+// Includes
+#include "Maze.h"
+
+// What check() found wrong with a maze, the first problem wins
+enum MazeProblem : uint8_t
+{
+    MAZE_OK,
+    MAZE_BAD_SIZE,          // too small or bigger than maxCells
+    MAZE_OPEN_BORDER,       // an opening leads off the grid
+    MAZE_ONE_WAY_WALL,      // a tile is open towards a neighbour that is walled off
+    MAZE_BAD_START,         // the start position is not the STARTTILE
+    MAZE_UNREACHABLE,       // a flower, ice block or the end can't be walked to
+    MAZE_TOO_FEW_FLOWERS,   // fewer flower buds than flowersToBloom
+    MAZE_TOO_MANY_FLOWERS   // more flower buds than the solver handles
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// Level checker, run on every maze at load. Validates the wall flags (both
+// sides of every wall agree, nothing opens off the grid), then walks the
+// maze breadth-first from the start to prove every objective is reachable.
+//
+// The solver then finds the shortest walk from the start that passes
+// flowersToBloom flower buds before the end: a BFS from the start and from
+// every bud gives the distances between objectives, and a bitmask DP over
+// the buds (Held-Karp) picks the best order. That's maxFlowers + 1 BFS
+// passes and 2^flowers * flowers^2 DP steps, microseconds for these grids.
+/////////////////////////////////////////////////////////////////////////////
+class MazeSolver
+{
+    public:
+        static const int maxCells = 64 * 64;
+        static const int maxFlowers = 10;
+
+        // Validates and solves a row-major maze, remembers where the problem is
+        static MazeProblem check(const FloorTile *cells, int width, int height, int startX, int startY, int endX,
+                                 int endY, int flowersToBloom);
+
+        // Tile the last check() stopped at (MAZE_OK leaves it at 0, 0)
+        static int problemX() { return badX; }
+        static int problemY() { return badY; }
+
+        // Steps in the shortest start -> flowers -> end walk of the last
+        // check(), -1 if it failed
+        static int routeLength() { return route; }
+
+        static const char *describe(MazeProblem problem);
+
+    private:
+        static const uint16_t UNREACHED = 0xFFFF;
+
+        static const FloorTile *grid;
+        static int gridWidth;
+        static int gridHeight;
+        static int badX;
+        static int badY;
+        static int route;
+
+        static uint16_t queue[maxCells];
+        static uint16_t distance[maxCells];
+        static uint16_t flowerCells[maxFlowers];
+
+        // Distances between objectives: the buds, then the start, then the end
+        static uint16_t legs[maxFlowers + 2][maxFlowers + 2];
+
+        // Shortest walk from the start through the buds in mask, ending on bud i
+        static uint16_t bestWalk[1 << maxFlowers][maxFlowers];
+
+        static MazeProblem problemAt(MazeProblem problem, int cell);
+        static MazeProblem checkWalls(int *flowerCount);
+        static void breadthFirst(int from);
+        static int shortestRoute(int flowerCount, int end, int flowersToBloom);
+};
+
+#endif
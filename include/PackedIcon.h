@@ -0,0 +1,71 @@
+#ifndef PACKED_ICON_H
+#define PACKED_ICON_H
+
+// Includes
+#include "Hal.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Palette + run-length compressed RGB565 icons (see tools/encode_icons.py).
+//
+// Each icon has its own palette of up to 128 colours and a byte stream read
+// in raster order:
+//      0x00-0x7F   one pixel of that palette index
+//      0x80-0xFF   (byte & 0x7F) + 2 pixels of the palette index that follows
+// Runs may continue across rows.
+/////////////////////////////////////////////////////////////////////////////
+struct PackedIcon
+{
+    uint16_t width;
+    uint16_t height;
+    uint8_t paletteSize;
+    const uint16_t *palette;
+    const uint8_t *data;
+    uint16_t dataSize;
+};
+
+// Streams an icon out one scanline at a time
+class IconDecoder
+{
+    public:
+        explicit IconDecoder(const PackedIcon &icon);
+
+        // Fills icon.width pixels, call once per row from the top
+        void decodeRow(uint16_t *row);
+
+    private:
+        const PackedIcon &icon;
+        const uint8_t *next;
+        uint16_t runColor;
+        int runLeft;
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// Keeps the last few decoded icons in RAM. A hit is a single pushImage, a
+// miss decodes row by row straight to the display while filling the least
+// recently used slot. The 60 KB of slots are only allocated on the first
+// draw (from PSRAM on the device); without them icons are streamed uncached.
+/////////////////////////////////////////////////////////////////////////////
+class IconCache
+{
+    public:
+        static const int maxIconSize = 100;
+        static const int slotCount = 3;
+
+        static void draw(const PackedIcon &icon, int x, int y);
+
+    private:
+        struct Slot
+        {
+            const PackedIcon *icon;
+            unsigned long lastUse;
+            uint16_t *pixels;
+        };
+
+        static Slot slots[slotCount];
+        static unsigned long useCount;
+        static bool allocated;
+
+        static bool allocate();
+};
+
+#endif
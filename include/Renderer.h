@@ -0,0 +1,70 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+// Includes
+#include "Maze.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Maze renderer. Walls are drawn once per level as coalesced runs, after that
+// only tiles marked dirty are repainted, all inside one SPI transaction per
+// frame.
+//
+// Mazes bigger than the screen are seen through a view of whole tiles. The
+// panel's hardware vertical scroll turns its memory into a ring of tile
+// rows: maze row r is always drawn at panel row (r % viewRows) and the
+// scroll start picks which of them is on top, so moving the view by a row
+// only needs that one strip of tiles drawn. There's no horizontal scroll,
+// so moving sideways redraws the view.
+/////////////////////////////////////////////////////////////////////////////
+class Renderer
+{
+    public:
+        // Paints the interior of one maze tile (floor, glyph, hat)
+        typedef void (*TileDrawer)(int col, int row);
+
+        // Draws the walls of tiles [colStart, colEnd) x [rowStart, rowEnd) of a
+        // row-major floor plan with the first of them at x, y, merging
+        // neighbouring wall segments into as few fillRect calls as possible
+        static void drawWalls(const FloorTile *tiles, int mazeWidth, int colStart, int colEnd, int rowStart,
+                              int rowEnd, int x, int y, uint32_t color);
+
+        // View, sized to the screen (call once the display is up)
+        static void beginView(int screenWidth, int screenHeight);
+        static void setView(int col, int row);
+        static int viewCol() { return viewLeft; }
+        static int viewRow() { return viewTop; }
+        static int viewCols() { return viewWidth; }
+        static int viewRows() { return viewHeight; }
+        static bool inView(int col, int row);
+
+        // Top left pixel of a tile in panel memory, and the scroll start
+        // that puts the view's top row on the top of the screen
+        static int tileX(int col) { return (col - viewLeft) * floorTileLength; }
+        static int tileY(int row) { return (row % viewHeight) * floorTileLength; }
+        static int scrollLines() { return tileY(viewTop); }
+
+        // Damage list
+        static void markDirty(int col, int row);
+        static bool hasDamage() { return damageCount > 0 || damageOverflow; }
+        static void clearDamage();
+
+        // Repaints the damaged tiles and clears the list
+        static void flush(TileDrawer drawTile);
+
+    private:
+        static const int maxDamage = 32;
+        static uint8_t damageCols[maxDamage];
+        static uint8_t damageRows[maxDamage];
+        static int damageCount;
+        static bool damageOverflow; // repaint every visible tile
+
+        static int viewLeft;
+        static int viewTop;
+        static int viewWidth;
+        static int viewHeight;
+
+        static void fillVerticalRun(int x, int y, int rows, uint8_t halves, uint32_t color);
+        static void fillHorizontalRun(int x, int y, int cols, uint8_t halves, uint32_t color);
+};
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef SENSOR_TASK_H
+#define SENSOR_TASK_H
+
+// Includes
+#include "Hal.h"
+#include "SpscRing.h"
+#include "TiltFilter.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Sensor acquisition, decoupled from the game tick. On the device a task
+// pinned to core 0 samples the IMU and runs the I2C queue while the game and
+// rendering keep core 1 (the Arduino loop task). The two sides only talk
+// through single-producer/single-consumer rings of timestamped samples, so
+// a slow I2C read never delays the next tilt move.
+//
+// The accelerometer is drained from its FIFO every imuBatchMs, a few
+// samples per bus burst, and filtered into a tilt direction on this side.
+//
+// Hosts have no second core; update() runs the same acquisition pass inline.
+/////////////////////////////////////////////////////////////////////////////
+struct TiltSample
+{
+    unsigned long timeMs;
+    int16_t accX;   // low-passed, milli-g
+    int16_t accY;
+    TiltDirection direction;
+};
+
+struct EnvSample
+{
+    unsigned long timeMs;
+    float temperature;  // degrees C
+    float humidity;     // %
+};
+
+struct LightSample
+{
+    unsigned long timeMs;
+    uint16_t whiteLight;
+    uint16_t ambientLight;
+};
+
+class SensorTask
+{
+    public:
+        static const unsigned long pollPeriodMs = 10;
+        static const unsigned long imuBatchMs = 40;
+
+        // Starts the acquisition task (device) or inline polling (host)
+        static void begin();
+
+        // Game side, once per loop: drains the tilt ring into latestTilt
+        // (and on the host runs the acquisition pass)
+        static void update();
+
+        // Newest filtered tilt, false until the first one arrives
+        static bool latestTilt(TiltSample *sample);
+
+        // Starts a conversion; the sample shows up in takeX() a few ms later
+        static void requestEnv(EnvPrecision precision);
+        static void requestLight();
+        static bool takeEnv(EnvSample *sample);
+        static bool takeLight(LightSample *sample);
+
+        // Watches for white light of at least whiteThreshold: the sensor's
+        // ambient threshold interrupt is programmed from a calibration
+        // reading and every alert is confirmed with a white reading. The
+        // first qualifying sample shows up in takeLight() and ends the
+        // watch. Interrupt driven when the INT line is wired; otherwise
+        // the backend polls the latched flag once per sensor integration
+        // period, only while the watch is armed.
+        static void watchLight(uint16_t whiteThreshold);
+        static void stopWatchingLight();
+
+    private:
+        enum Command : uint8_t
+        {
+            REQUEST_ENV,
+            REQUEST_LIGHT,
+            WATCH_LIGHT,
+            STOP_WATCHING_LIGHT
+        };
+
+        struct Request
+        {
+            Command command;
+            uint16_t value;
+        };
+
+        enum WatchState : uint8_t
+        {
+            WATCH_OFF,
+            WATCH_CALIBRATING,  // first reading in flight
+            WATCH_ARMED,        // waiting for the sensor to flag
+            WATCH_CONFIRMING    // flagged (or recheck due), reading white
+        };
+
+        // A watch also reads back this often in case the ambient/white
+        // ratio drifted away from the calibration
+        static const unsigned long watchRecheckMs = 1000;
+
+        // game -> sensors
+        static SpscRing<Request, 8> commands;
+        // sensors -> game
+        static SpscRing<TiltSample, 16> tiltSamples;
+        static SpscRing<EnvSample, 4> envSamples;
+        static SpscRing<LightSample, 4> lightSamples;
+
+        // Owned by the game side
+        static TiltSample tilt;
+        static bool haveTilt;
+
+        // Owned by the sensor side
+        static TiltFilter tiltFilter;
+        static unsigned long nextImuMs;
+        static bool envPending;
+        static bool lightPending;
+        static WatchState watchState;
+        static uint16_t watchThreshold;     // white
+        static uint16_t watchAmbient;       // what the sensor is programmed with
+        static unsigned long nextWatchCheckMs;
+
+        // One acquisition pass, and the task that repeats it (device only)
+        static void poll();
+        static void watchReading(const LightSample &sample);
+        static void taskMain(void *unused);
+};
+
+#endif
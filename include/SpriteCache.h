@@ -0,0 +1,49 @@
+#ifndef SPRITE_CACHE_H
+#define SPRITE_CACHE_H
+
+// Includes
+#include "Hal.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Glyph sprite cache. Each small icon (flower, bud, ice block, hat) is
+// rendered once into an RGB565 sprite and from then on drawn with a single
+// transparent pushImage instead of 3-6 circle/ellipse primitives.
+//
+// A glyph is identified by its render function plus up to two colours, so
+// the same flower in another colour gets its own sprite.
+/////////////////////////////////////////////////////////////////////////////
+
+// Draws a glyph centred on (xCenter, yCenter), must stay inside spriteRadius
+typedef void (*GlyphRenderer)(HalDisplay &gfx, int xCenter, int yCenter, uint32_t color1, uint32_t color2);
+
+class SpriteCache
+{
+    public:
+        static const int spriteRadius = 10;
+        static const int spriteSize = 2 * spriteRadius + 1;
+        static const uint16_t transparentColor = 0x0120; // same key as TFT_TRANSPARENT
+
+        // Renders the glyph ahead of time so the first draw is a plain blit
+        static bool prepare(GlyphRenderer render, uint32_t color1 = 0, uint32_t color2 = 0);
+
+        // Blits the cached glyph (rendering it on first use)
+        static void draw(GlyphRenderer render, int xCenter, int yCenter, uint32_t color1 = 0, uint32_t color2 = 0);
+
+    private:
+        struct Sprite
+        {
+            GlyphRenderer render;
+            uint32_t color1;
+            uint32_t color2;
+            uint16_t pixels[spriteSize * spriteSize];
+        };
+
+        static const int maxSprites = 8;
+        static Sprite sprites[maxSprites];
+        static int spriteCount;
+
+        static Sprite *find(GlyphRenderer render, uint32_t color1, uint32_t color2);
+        static Sprite *fetch(GlyphRenderer render, uint32_t color1, uint32_t color2);
+};
+
+#endif
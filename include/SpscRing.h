@@ -0,0 +1,55 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+// Includes
+#include <stddef.h>
+#include <atomic>
+
+/////////////////////////////////////////////////////////////////////////////
+// Lock-free single-producer / single-consumer ring buffer. One context may
+// push() (task, callback, ISR) while another pop()s, without locks and
+// without allocating. Size must be a power of two; one slot stays empty.
+/////////////////////////////////////////////////////////////////////////////
+template <typename T, size_t Size>
+class SpscRing
+{
+    static_assert(Size >= 2 && (Size & (Size - 1)) == 0, "SpscRing size must be a power of two");
+
+    public:
+        SpscRing() : head(0), tail(0) {}
+
+        // Producer side, false (item dropped) when full
+        bool push(const T &item)
+        {
+            size_t h = head.load(std::memory_order_relaxed);
+            size_t next = (h + 1) & (Size - 1);
+            if (next == tail.load(std::memory_order_acquire))
+                return false;
+            items[h] = item;
+            head.store(next, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side, false when empty
+        bool pop(T &item)
+        {
+            size_t t = tail.load(std::memory_order_relaxed);
+            if (t == head.load(std::memory_order_acquire))
+                return false;
+            item = items[t];
+            tail.store((t + 1) & (Size - 1), std::memory_order_release);
+            return true;
+        }
+
+        bool empty() const
+        {
+            return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+        }
+
+    private:
+        T items[Size];
+        std::atomic<size_t> head;   // next slot to write, owned by the producer
+        std::atomic<size_t> tail;   // next slot to read, owned by the consumer
+};
+
+#endif
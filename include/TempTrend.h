@@ -0,0 +1,49 @@
+#ifndef TEMP_TREND_H
+#define TEMP_TREND_H
+
+// Includes
+#include <stdint.h>
+
+/////////////////////////////////////////////////////////////////////////////
+// Incremental temperature trend (Holt's linear smoothing in fixed point):
+// a level and a slope, both updated from each SHT40 reading. The level
+// follows a steady warm-up without the lag of a plain average, a lone
+// outlier moves it by at most maxStepMilliC, and the slope predicts when a
+// target temperature will be crossed so reads can be spaced out until then.
+/////////////////////////////////////////////////////////////////////////////
+class TempTrend
+{
+    public:
+        // A reading further than this from the prediction is clipped
+        static const int32_t maxStepMilliC = 300;
+
+        TempTrend() { reset(); }
+
+        void reset();
+        void update(float celsius, unsigned long timeMs);
+
+        bool empty() const { return samples == 0; }
+
+        // Smoothed temperature, and its rate of change per second
+        float level() const { return levelMilliC / 1000.0f; }
+        float slope() const { return slopeMilliCPerS / 1000.0f; }
+
+        // Smoothed temperature at or above target
+        bool reached(float target) const;
+
+        // How long to wait before the next reading: half the predicted time
+        // to target, so reads close in on the crossing, within [minMs, maxMs]
+        unsigned long readDelayMs(float target, unsigned long minMs, unsigned long maxMs) const;
+
+    private:
+        // Weights of the newest reading (1 / 2^shift) in level and slope
+        static const int levelShift = 1;
+        static const int slopeShift = 2;
+
+        int32_t levelMilliC;
+        int32_t slopeMilliCPerS;
+        unsigned long lastMs;
+        uint8_t samples;    // saturates at 2
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef TILE_ATLAS_H
+#define TILE_ATLAS_H
+
+// Includes
+#include "Maze.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Pre-rendered maze tiles. A tile's whole 40x40 box (its half walls, floor
+// and glyph) only depends on its four openings and what its floor shows, so
+// every combination is rendered once into an RGB565 image and from then on
+// drawn with a single pushImage: a full screen of maze is 48 blits, a
+// changed tile is one.
+//
+// The atlas holds 16 opening masks x lookCount looks, 300 KB, so on the
+// device it lives in PSRAM. Tiles are rendered on first use. Without the
+// memory begin() fails and callers keep drawing with primitives.
+/////////////////////////////////////////////////////////////////////////////
+
+// What a tile's floor shows: a FloorType, or the end once it's open
+const uint8_t END_LOOK = STARTTILE + 1;
+
+// Draws one tile into a floorTileLength square at 0, 0
+typedef void (*TileRenderer)(HalDisplay &gfx, uint8_t openings, uint8_t look);
+
+class TileAtlas
+{
+    public:
+        static const int tileSize = floorTileLength;
+        static const int lookCount = END_LOOK + 1;
+
+        // Allocates the atlas, false (and ready() stays false) without the memory
+        static bool begin(TileRenderer render);
+        static bool ready() { return atlas != NULL; }
+
+        // Blits the tile with its top left at x, y, rendering it on first use
+        static void draw(int x, int y, uint8_t openings, uint8_t look);
+
+    private:
+        static const int tileCount = (OPEN_MASK + 1) * lookCount;
+        static const int tilePixels = tileSize * tileSize;
+
+        static uint16_t *atlas;
+        static uint8_t rendered[(tileCount + 7) / 8];
+        static TileRenderer renderer;
+};
+
+#endif
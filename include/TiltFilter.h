@@ -0,0 +1,58 @@
+#ifndef TILT_FILTER_H
+#define TILT_FILTER_H
+
+// Includes
+#include "Hal.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Tilt direction from a stream of accelerometer samples. Each axis runs
+// through a fixed-point one-pole low-pass (no floats on the sensor task),
+// then the dominant axis is classified with hysteresis: a direction is
+// entered above enterMg, kept until it drops below exitMg, and only handed
+// to the other axis once that axis leads by switchMarginMg. Small wobbles
+// around a threshold therefore no longer flip the hat back and forth.
+/////////////////////////////////////////////////////////////////////////////
+enum TiltDirection : uint8_t
+{
+    TILT_NONE,
+    TILT_LEFT,      // +X
+    TILT_RIGHT,     // -X
+    TILT_UP,        // -Y
+    TILT_DOWN       // +Y
+};
+
+class TiltFilter
+{
+    public:
+        // ~1 m/s^2, the old single-sample threshold
+        static const int enterMg = 100;
+        static const int exitMg = 70;
+        static const int switchMarginMg = 30;
+
+        // Low-pass weight of a new sample is 1 / 2^smoothingShift; at the
+        // 100 Hz FIFO rate a shift of 2 settles in about 40 ms
+        static const int smoothingShift = 2;
+
+        TiltFilter() { reset(); }
+
+        void reset();
+        void update(const AccelSample &sample);
+
+        TiltDirection direction() const { return current; }
+
+        // Filtered acceleration in milli-g
+        int16_t x() const { return (int16_t)(filteredX >> fractionBits); }
+        int16_t y() const { return (int16_t)(filteredY >> fractionBits); }
+
+    private:
+        static const int fractionBits = 8;
+
+        int32_t filteredX;  // milli-g << fractionBits
+        int32_t filteredY;
+        bool primed;        // first sample seeds the filter
+        TiltDirection current;
+
+        void classify();
+};
+
+#endif
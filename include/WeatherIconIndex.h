@@ -0,0 +1,93 @@
+#ifndef WEATHER_ICON_INDEX_H
+#define WEATHER_ICON_INDEX_H
+
+// Includes
+#include <stdint.h>
+
+/////////////////////////////////////////////////////////////////////////////
+// Maps an OpenWeather icon code ("01d", "10n", "50d", ...) to one of our
+// bitmaps in constant time. The two digits pick a row of a constexpr table,
+// the third character picks day, night or "either". Codes without an icon
+// (and strings shorter than two digits) give noWeatherIcon.
+/////////////////////////////////////////////////////////////////////////////
+
+// Same order as the arrays in EGR425_Phase1_weather_bitmap_images.h
+enum WeatherIconId
+{
+    ICON_01D,
+    ICON_01N,
+    ICON_02D,
+    ICON_02N,
+    ICON_03D,
+    ICON_09D,
+    ICON_04D,
+    ICON_10D,
+    ICON_10N,
+    ICON_11D,
+    ICON_13D,
+    ICON_50D,
+    WEATHER_ICON_COUNT
+};
+
+const int noWeatherIcon = -1;
+
+struct WeatherIconTable
+{
+    // [code 00-99][third char: 'd', 'n', anything else]
+    int8_t ids[100][3];
+};
+
+constexpr WeatherIconTable makeWeatherIconTable()
+{
+    WeatherIconTable table = {};
+    for (int code = 0; code < 100; code++)
+        for (int suffix = 0; suffix < 3; suffix++)
+            table.ids[code][suffix] = noWeatherIcon;
+
+    // day and night variants, the code alone does not match
+    table.ids[1][0] = ICON_01D;
+    table.ids[1][1] = ICON_01N;
+    table.ids[2][0] = ICON_02D;
+    table.ids[2][1] = ICON_02N;
+    table.ids[10][0] = ICON_10D;
+    table.ids[10][1] = ICON_10N;
+
+    // one icon for any suffix
+    for (int suffix = 0; suffix < 3; suffix++)
+    {
+        table.ids[3][suffix] = ICON_03D;
+        table.ids[4][suffix] = ICON_04D;
+        table.ids[9][suffix] = ICON_09D;
+        table.ids[11][suffix] = ICON_11D;
+        table.ids[13][suffix] = ICON_13D;
+        table.ids[50][suffix] = ICON_50D;
+    }
+    return table;
+}
+
+constexpr WeatherIconTable weatherIconTable = makeWeatherIconTable();
+
+constexpr bool isIconDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// WeatherIconId for the code, or noWeatherIcon
+constexpr int weatherIconId(const char *iconId)
+{
+    if (!iconId || !isIconDigit(iconId[0]) || !isIconDigit(iconId[1]))
+        return noWeatherIcon;
+
+    int code = (iconId[0] - '0') * 10 + (iconId[1] - '0');
+    int suffix = iconId[2] == 'd' ? 0 : iconId[2] == 'n' ? 1 : 2;
+    return weatherIconTable.ids[code][suffix];
+}
+
+// Same answers as the old startsWith() chain
+static_assert(weatherIconId("01d") == ICON_01D && weatherIconId("01n") == ICON_01N, "01");
+static_assert(weatherIconId("03n") == ICON_03D && weatherIconId("04d") == ICON_04D, "03/04");
+static_assert(weatherIconId("10n") == ICON_10N && weatherIconId("50n") == ICON_50D, "10/50");
+static_assert(weatherIconId("01") == noWeatherIcon && weatherIconId("12d") == noWeatherIcon, "no icon");
+static_assert(weatherIconId("") == noWeatherIcon && weatherIconId("5") == noWeatherIcon, "short");
+
+#endif
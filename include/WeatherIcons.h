@@ -0,0 +1,539 @@
+#ifndef WEATHER_ICONS_H
+#define WEATHER_ICONS_H
+
+/////////////////////////////////////////////////////////////////////////////
+// GENERATED by tools/encode_icons.py from
+// EGR425_Phase1_weather_bitmap_images.h -- do not edit by hand.
+/////////////////////////////////////////////////////////////////////////////
+
+// Includes
+#include "PackedIcon.h"
+#include "WeatherIconIndex.h"
+
+// 'i01d', 17 colours, 341 bytes
+static const uint16_t i01dPalette[] PROGMEM = {
+	0x0000, 0xEB69, 0xEB89, 0xEB49, 0xFC08, 0xFB26, 0xF389, 0xE329, 0xE369, 0xEB4A, 0xEB8A, 0xF349,
+	0xF34A, 0xF369, 0xF388, 0xF800, 0xFAAA
+};
+static const uint8_t i01dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBE, 0x00, 0x0E, 0x89, 0x01, 0x03, 0xD2, 0x00,
+	0x03, 0x90, 0x01, 0xCD, 0x00, 0x0A, 0x93, 0x01, 0x02, 0xC9, 0x00, 0x08, 0x98, 0x01, 0xC6, 0x00,
+	0x9B, 0x01, 0xC4, 0x00, 0x9D, 0x01, 0x04, 0xC1, 0x00, 0x9F, 0x01, 0x03, 0xBE, 0x00, 0x04, 0xA1,
+	0x01, 0x03, 0xBD, 0x00, 0xA3, 0x01, 0x04, 0xBB, 0x00, 0xA5, 0x01, 0x05, 0xB9, 0x00, 0xA7, 0x01,
+	0xB8, 0x00, 0xA8, 0x01, 0x02, 0xB7, 0x00, 0xA9, 0x01, 0xB6, 0x00, 0x0C, 0xAA, 0x01, 0xB5, 0x00,
+	0xAB, 0x01, 0x10, 0xB3, 0x00, 0x03, 0xAC, 0x01, 0xB3, 0x00, 0xAD, 0x01, 0xB3, 0x00, 0xAD, 0x01,
+	0x04, 0xB1, 0x00, 0x09, 0xAE, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00,
+	0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00,
+	0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00,
+	0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB2, 0x00, 0xAE, 0x01, 0xB2, 0x00, 0xAD, 0x01, 0xB3, 0x00,
+	0x02, 0xAC, 0x01, 0xB4, 0x00, 0xAB, 0x01, 0x0B, 0xB4, 0x00, 0x02, 0xAA, 0x01, 0xB6, 0x00, 0xA9,
+	0x01, 0xB7, 0x00, 0xA9, 0x01, 0xB8, 0x00, 0xA7, 0x01, 0xB9, 0x00, 0x0F, 0xA6, 0x01, 0xBB, 0x00,
+	0xA3, 0x01, 0x02, 0xBC, 0x00, 0xA3, 0x01, 0xBE, 0x00, 0x0D, 0xA0, 0x01, 0xC0, 0x00, 0x07, 0x9E,
+	0x01, 0xC2, 0x00, 0x05, 0x9C, 0x01, 0xC5, 0x00, 0x99, 0x01, 0xC9, 0x00, 0x95, 0x01, 0x05, 0xCC,
+	0x00, 0x02, 0x90, 0x01, 0x06, 0xD0, 0x00, 0x04, 0x8B, 0x01, 0x06, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xD9, 0x00
+};
+
+// 'i01n', 10 colours, 348 bytes
+static const uint16_t i01nPalette[] PROGMEM = {
+	0x0000, 0x4A49, 0x4229, 0x4208, 0x3186, 0x4A69, 0x4209, 0x4228, 0x420A, 0x52AA
+};
+static const uint8_t i01nData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xBE, 0x00, 0x07, 0x01, 0x02, 0x84, 0x01, 0x02,
+	0x01, 0x02, 0x01, 0xD2, 0x00, 0x8F, 0x01, 0x02, 0x01, 0xCD, 0x00, 0x95, 0x01, 0xC9, 0x00, 0x99,
+	0x01, 0xC6, 0x00, 0x9B, 0x01, 0xC4, 0x00, 0x02, 0x9C, 0x01, 0x03, 0xC1, 0x00, 0xA0, 0x01, 0xBE,
+	0x00, 0x03, 0xA2, 0x01, 0xBD, 0x00, 0xA3, 0x01, 0x03, 0xBB, 0x00, 0xA4, 0x01, 0x02, 0x04, 0xB9,
+	0x00, 0xA6, 0x01, 0x02, 0xB8, 0x00, 0xA9, 0x01, 0xB7, 0x00, 0xA9, 0x01, 0xB6, 0x00, 0x08, 0xA9,
+	0x01, 0x02, 0xB5, 0x00, 0xAB, 0x01, 0x09, 0xB3, 0x00, 0xAD, 0x01, 0xB3, 0x00, 0x02, 0xAC, 0x01,
+	0xB3, 0x00, 0xAD, 0x01, 0x03, 0xB1, 0x00, 0x03, 0xAD, 0x01, 0x02, 0xB1, 0x00, 0x02, 0xAE, 0x01,
+	0xB1, 0x00, 0x02, 0xAE, 0x01, 0xB1, 0x00, 0x02, 0xAE, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00,
+	0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00, 0x02, 0xAE, 0x01, 0xB1,
+	0x00, 0x02, 0xAE, 0x01, 0xB1, 0x00, 0xAF, 0x01, 0xB1, 0x00, 0x02, 0xAE, 0x01, 0xB1, 0x00, 0x06,
+	0xAD, 0x01, 0x02, 0xB2, 0x00, 0xAE, 0x01, 0xB2, 0x00, 0xAD, 0x01, 0xB3, 0x00, 0xAD, 0x01, 0xB4,
+	0x00, 0xAC, 0x01, 0xB4, 0x00, 0x07, 0xA9, 0x01, 0x02, 0xB6, 0x00, 0xA9, 0x01, 0xB7, 0x00, 0x02,
+	0xA8, 0x01, 0xB8, 0x00, 0xA6, 0x01, 0x02, 0xBA, 0x00, 0xA5, 0x01, 0x06, 0xBB, 0x00, 0xA4, 0x01,
+	0xBC, 0x00, 0xA3, 0x01, 0xBE, 0x00, 0x02, 0xA0, 0x01, 0xC0, 0x00, 0x05, 0x9E, 0x01, 0xC2, 0x00,
+	0x04, 0x02, 0x99, 0x01, 0x80, 0x02, 0xC5, 0x00, 0x99, 0x01, 0xC9, 0x00, 0x02, 0x93, 0x01, 0x02,
+	0x04, 0xCC, 0x00, 0x90, 0x01, 0x02, 0x05, 0xD0, 0x00, 0x03, 0x02, 0x88, 0x01, 0x02, 0x01, 0x05,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xD9, 0x00
+};
+
+// 'i02d', 57 colours, 609 bytes
+static const uint16_t i02dPalette[] PROGMEM = {
+	0x0000, 0xF79E, 0xEB69, 0xF7FF, 0xF7BE, 0xEAA5, 0xEB89, 0xF79D, 0xF7DF, 0xEB28, 0xEB8A, 0xFFFF,
+	0xEA85, 0xEAC6, 0xEAE6, 0xEB48, 0xEB49, 0xEB07, 0xECAF, 0xF71B, 0xF7BD, 0xEAE7, 0xEC2D, 0xEC8F,
+	0xECD0, 0xECF0, 0xED11, 0xEDB4, 0xF657, 0xF678, 0xF75C, 0xE2C6, 0xE369, 0xEA02, 0xEA43, 0xEA84,
+	0xEAA6, 0xEB27, 0xEB88, 0xEBA9, 0xEC0C, 0xEC4E, 0xED73, 0xEF5D, 0xEF7D, 0xF34A, 0xF389, 0xF5D5,
+	0xF5F5, 0xF5F6, 0xF658, 0xF6B9, 0xF6DA, 0xF6FA, 0xF6FB, 0xF73C, 0xF77D
+};
+static const uint8_t i02dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF8, 0x00, 0x06, 0x88,
+	0x02, 0xD4, 0x00, 0x27, 0x8D, 0x02, 0x20, 0xD0, 0x00, 0x91, 0x02, 0xCD, 0x00, 0x2E, 0x93, 0x02,
+	0x06, 0xCA, 0x00, 0x0A, 0x96, 0x02, 0xBB, 0x00, 0x0B, 0x85, 0x01, 0x83, 0x00, 0x10, 0x98, 0x02,
+	0xB8, 0x00, 0x8A, 0x01, 0x80, 0x00, 0x1F, 0x9A, 0x02, 0xB6, 0x00, 0x8B, 0x01, 0x03, 0x1D, 0x0C,
+	0x9A, 0x02, 0xB4, 0x00, 0x8D, 0x01, 0x08, 0x04, 0x29, 0x0C, 0x9A, 0x02, 0xB2, 0x00, 0x8E, 0x01,
+	0x07, 0x80, 0x03, 0x16, 0x05, 0x06, 0x98, 0x02, 0x06, 0xB1, 0x00, 0x8F, 0x01, 0x07, 0x03, 0x04,
+	0x02, 0x0E, 0x06, 0x98, 0x02, 0xB0, 0x00, 0x92, 0x01, 0x03, 0x1D, 0x05, 0x10, 0x98, 0x02, 0xAF,
+	0x00, 0x93, 0x01, 0x04, 0x03, 0x19, 0x05, 0x99, 0x02, 0xAE, 0x00, 0x93, 0x01, 0x07, 0x03, 0x32,
+	0x05, 0x99, 0x02, 0xAE, 0x00, 0x94, 0x01, 0x03, 0x38, 0x0A, 0x09, 0x0F, 0x0D, 0x81, 0x05, 0x0D,
+	0x0F, 0x06, 0x90, 0x02, 0xAD, 0x00, 0x04, 0x94, 0x01, 0x04, 0x03, 0x12, 0x21, 0x25, 0x12, 0x1B,
+	0x2F, 0x1B, 0x18, 0x09, 0x05, 0x90, 0x02, 0xAD, 0x00, 0x96, 0x01, 0x03, 0x1A, 0x06, 0x36, 0x83,
+	0x03, 0x13, 0x12, 0x0C, 0x09, 0x0A, 0x8D, 0x02, 0xAD, 0x00, 0x96, 0x01, 0x04, 0x13, 0x04, 0x03,
+	0x83, 0x01, 0x80, 0x03, 0x31, 0x15, 0x09, 0x8D, 0x02, 0xAD, 0x00, 0x96, 0x01, 0x07, 0x03, 0x08,
+	0x07, 0x83, 0x01, 0x07, 0x08, 0x03, 0x2A, 0x0C, 0x8D, 0x02, 0xAD, 0x00, 0x2C, 0xA0, 0x01, 0x08,
+	0x03, 0x28, 0x0D, 0x8C, 0x02, 0xA9, 0x00, 0x14, 0xA4, 0x01, 0x07, 0x03, 0x1C, 0x0D, 0x8C, 0x02,
+	0xA7, 0x00, 0xA8, 0x01, 0x03, 0x13, 0x10, 0x0F, 0x8B, 0x02, 0xA5, 0x00, 0x14, 0xA9, 0x01, 0x03,
+	0x1E, 0x0A, 0x09, 0x8B, 0x02, 0xA4, 0x00, 0xAB, 0x01, 0x03, 0x1E, 0x0A, 0x09, 0x8A, 0x02, 0x2D,
+	0xA3, 0x00, 0x14, 0xAB, 0x01, 0x03, 0x34, 0x0C, 0x23, 0x0D, 0x0E, 0x09, 0x87, 0x02, 0xA3, 0x00,
+	0x2B, 0xAC, 0x01, 0x03, 0x33, 0x17, 0x1A, 0x18, 0x16, 0x10, 0x05, 0x0F, 0x06, 0x83, 0x02, 0x06,
+	0xA3, 0x00, 0xAD, 0x01, 0x07, 0x04, 0x82, 0x03, 0x37, 0x19, 0x24, 0x15, 0x0A, 0x82, 0x02, 0xA3,
+	0x00, 0x0B, 0xAF, 0x01, 0x04, 0x80, 0x01, 0x04, 0x80, 0x03, 0x1C, 0x11, 0x0E, 0x0A, 0x80, 0x02,
+	0x26, 0xA3, 0x00, 0xB5, 0x01, 0x04, 0x03, 0x35, 0x80, 0x11, 0x80, 0x02, 0xA4, 0x00, 0xB7, 0x01,
+	0x03, 0x30, 0x22, 0x0E, 0xA5, 0x00, 0xB7, 0x01, 0x80, 0x08, 0x17, 0xA6, 0x00, 0xB7, 0x01, 0x07,
+	0x80, 0x08, 0xA6, 0x00, 0xB9, 0x01, 0x04, 0xA6, 0x00, 0xBA, 0x01, 0x0B, 0xA5, 0x00, 0xBA, 0x01,
+	0x0B, 0xA5, 0x00, 0xBA, 0x01, 0xA7, 0x00, 0xB9, 0x01, 0xA7, 0x00, 0xB9, 0x01, 0xA8, 0x00, 0xB7,
+	0x01, 0xAA, 0x00, 0xB6, 0x01, 0xAB, 0x00, 0xB4, 0x01, 0xAD, 0x00, 0xB2, 0x01, 0xAF, 0x00, 0x0B,
+	0xAE, 0x01, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF3, 0x00
+};
+
+// 'i02n', 57 colours, 621 bytes
+static const uint16_t i02nPalette[] PROGMEM = {
+	0x0000, 0xF79E, 0x4A49, 0xFFFF, 0x4229, 0xF7BE, 0x2945, 0xF79D, 0x4A69, 0x39C7, 0x39E7, 0x4228,
+	0xFFDF, 0x2104, 0x2965, 0x3186, 0x4208, 0x7BEF, 0xDEFB, 0xF7BD, 0xFFDE, 0x2124, 0x2125, 0x31A6,
+	0x4A6A, 0x8410, 0x8C51, 0xA534, 0xC618, 0xE73C, 0xEF7D, 0x0862, 0x10A3, 0x2966, 0x39E8, 0x420A,
+	0x630C, 0x632D, 0x6B4D, 0x6B6D, 0x73AE, 0x73AF, 0x7BCF, 0x7BF0, 0x9CD3, 0xA514, 0xAD75, 0xB596,
+	0xBDD7, 0xBDF7, 0xC638, 0xCE79, 0xD69A, 0xD6BA, 0xD6BB, 0xE71C, 0xEF5D
+};
+static const uint8_t i02nData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF8, 0x00, 0x80, 0x02,
+	0x80, 0x04, 0x83, 0x02, 0x80, 0x04, 0xD4, 0x00, 0x08, 0x04, 0x8B, 0x02, 0x04, 0x02, 0xD0, 0x00,
+	0x91, 0x02, 0xCD, 0x00, 0x08, 0x94, 0x02, 0xCA, 0x00, 0x97, 0x02, 0xBB, 0x00, 0x03, 0x85, 0x01,
+	0x83, 0x00, 0x99, 0x02, 0xB8, 0x00, 0x8A, 0x01, 0x80, 0x00, 0x15, 0x99, 0x02, 0x04, 0xB6, 0x00,
+	0x8B, 0x01, 0x03, 0x1C, 0x0D, 0x0B, 0x98, 0x02, 0x04, 0xB4, 0x00, 0x8D, 0x01, 0x0C, 0x01, 0x27,
+	0x0D, 0x99, 0x02, 0x04, 0xB2, 0x00, 0x8E, 0x01, 0x07, 0x80, 0x03, 0x25, 0x16, 0x99, 0x02, 0x08,
+	0xB1, 0x00, 0x8F, 0x01, 0x07, 0x03, 0x05, 0x04, 0x0F, 0x99, 0x02, 0xB0, 0x00, 0x92, 0x01, 0x03,
+	0x32, 0x06, 0x0B, 0x98, 0x02, 0xAF, 0x00, 0x93, 0x01, 0x05, 0x03, 0x19, 0x06, 0x99, 0x02, 0xAE,
+	0x00, 0x93, 0x01, 0x07, 0x03, 0x1C, 0x06, 0x04, 0x81, 0x02, 0x04, 0x94, 0x02, 0xAE, 0x00, 0x94,
+	0x01, 0x03, 0x1E, 0x18, 0x0A, 0x10, 0x0E, 0x81, 0x06, 0x0E, 0x10, 0x91, 0x02, 0xAD, 0x00, 0x05,
+	0x94, 0x01, 0x05, 0x03, 0x11, 0x1F, 0x09, 0x11, 0x2D, 0x80, 0x1B, 0x2B, 0x0A, 0x06, 0x04, 0x8F,
+	0x02, 0xAD, 0x00, 0x96, 0x01, 0x03, 0x1A, 0x02, 0x36, 0x83, 0x03, 0x12, 0x2A, 0x16, 0x0A, 0x08,
+	0x8D, 0x02, 0xAD, 0x00, 0x96, 0x01, 0x05, 0x12, 0x14, 0x03, 0x05, 0x81, 0x01, 0x05, 0x80, 0x03,
+	0x2F, 0x17, 0x0A, 0x8D, 0x02, 0xAD, 0x00, 0x96, 0x01, 0x07, 0x80, 0x03, 0x07, 0x83, 0x01, 0x07,
+	0x0C, 0x03, 0x2C, 0x0D, 0x8D, 0x02, 0xAD, 0x00, 0x1E, 0xA0, 0x01, 0x0C, 0x03, 0x24, 0x21, 0x8C,
+	0x02, 0xA9, 0x00, 0x13, 0xA4, 0x01, 0x07, 0x03, 0x31, 0x0E, 0x04, 0x8B, 0x02, 0xA7, 0x00, 0xA8,
+	0x01, 0x03, 0x12, 0x0B, 0x10, 0x8B, 0x02, 0xA5, 0x00, 0x13, 0xA9, 0x01, 0x03, 0x1D, 0x08, 0x0A,
+	0x8B, 0x02, 0xA4, 0x00, 0xAB, 0x01, 0x03, 0x1D, 0x18, 0x09, 0x8A, 0x02, 0x23, 0xA3, 0x00, 0x13,
+	0xAB, 0x01, 0x03, 0x34, 0x15, 0x0D, 0x0E, 0x0F, 0x22, 0x87, 0x02, 0xA3, 0x00, 0x38, 0xAC, 0x01,
+	0x03, 0x33, 0x29, 0x1A, 0x11, 0x26, 0x0B, 0x06, 0x10, 0x85, 0x02, 0xA3, 0x00, 0xAD, 0x01, 0x07,
+	0x05, 0x82, 0x03, 0x37, 0x19, 0x06, 0x17, 0x08, 0x81, 0x02, 0x04, 0xA3, 0x00, 0x03, 0xAF, 0x01,
+	0x05, 0x01, 0x05, 0x14, 0x80, 0x03, 0x30, 0x09, 0x0F, 0x08, 0x80, 0x02, 0x0B, 0xA3, 0x00, 0xB5,
+	0x01, 0x05, 0x03, 0x35, 0x80, 0x09, 0x80, 0x02, 0xA4, 0x00, 0xB7, 0x01, 0x03, 0x2E, 0x20, 0x0F,
+	0xA5, 0x00, 0xB7, 0x01, 0x0C, 0x03, 0x28, 0xA6, 0x00, 0xB7, 0x01, 0x07, 0x0C, 0x03, 0xA6, 0x00,
+	0xB9, 0x01, 0x14, 0xA6, 0x00, 0xBA, 0x01, 0x03, 0xA5, 0x00, 0xBA, 0x01, 0x03, 0xA5, 0x00, 0xBA,
+	0x01, 0xA7, 0x00, 0xB9, 0x01, 0xA7, 0x00, 0xB9, 0x01, 0xA8, 0x00, 0xB7, 0x01, 0xAA, 0x00, 0xB6,
+	0x01, 0xAB, 0x00, 0xB4, 0x01, 0xAD, 0x00, 0xB2, 0x01, 0xAF, 0x00, 0x03, 0xAE, 0x01, 0x03, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF3, 0x00
+};
+
+// 'i03d', 7 colours, 294 bytes
+static const uint16_t i03dPalette[] PROGMEM = {
+	0x0000, 0xF79E, 0xFFFF, 0xEF7D, 0xF7BD, 0xE73C, 0xEF5D
+};
+static const uint8_t i03dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0x8E, 0x00, 0x03, 0x85, 0x01, 0x04, 0xD7, 0x00, 0x8B, 0x01, 0xD4, 0x00, 0x8D, 0x01,
+	0x03, 0xD1, 0x00, 0x90, 0x01, 0xCF, 0x00, 0x92, 0x01, 0xCD, 0x00, 0x93, 0x01, 0xCC, 0x00, 0x04,
+	0x94, 0x01, 0xCB, 0x00, 0x96, 0x01, 0xC9, 0x00, 0x02, 0x96, 0x01, 0xC9, 0x00, 0x97, 0x01, 0x82,
+	0x00, 0x80, 0x02, 0xC3, 0x00, 0x97, 0x01, 0x00, 0x04, 0x85, 0x01, 0xC0, 0x00, 0xA1, 0x01, 0xBF,
+	0x00, 0xA2, 0x01, 0xBE, 0x00, 0xA3, 0x01, 0xBA, 0x00, 0x80, 0x01, 0x00, 0xA3, 0x01, 0xB7, 0x00,
+	0x06, 0xA9, 0x01, 0xB4, 0x00, 0x05, 0xAB, 0x01, 0xB3, 0x00, 0x03, 0xAC, 0x01, 0xB2, 0x00, 0x03,
+	0xAD, 0x01, 0xB1, 0x00, 0x02, 0xAD, 0x01, 0x04, 0x01, 0x04, 0x02, 0xAE, 0x00, 0xB4, 0x01, 0xAB,
+	0x00, 0x02, 0xB5, 0x01, 0xAA, 0x00, 0xB7, 0x01, 0x02, 0xA8, 0x00, 0xB8, 0x01, 0xA8, 0x00, 0xB9,
+	0x01, 0xA7, 0x00, 0xB9, 0x01, 0xA7, 0x00, 0xB9, 0x01, 0xA7, 0x00, 0xB9, 0x01, 0xA7, 0x00, 0xB9,
+	0x01, 0xA7, 0x00, 0xB9, 0x01, 0xA8, 0x00, 0xB8, 0x01, 0xA8, 0x00, 0xB8, 0x01, 0xA9, 0x00, 0xB7,
+	0x01, 0xA9, 0x00, 0x02, 0xB5, 0x01, 0xAB, 0x00, 0x02, 0xB3, 0x01, 0xAD, 0x00, 0x02, 0xB1, 0x01,
+	0xB0, 0x00, 0x02, 0xAD, 0x01, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x9A, 0x00
+};
+
+// 'i09d', 59 colours, 758 bytes
+static const uint16_t i09dPalette[] PROGMEM = {
+	0x0000, 0xF79E, 0x4A49, 0xFFFF, 0x4229, 0xF7BE, 0xFFDF, 0xF79D, 0x3186, 0x4208, 0x2125, 0x4228,
+	0x2945, 0x4A69, 0xE73C, 0xEF7D, 0x39C7, 0x2966, 0x31A6, 0x31A7, 0x39E7, 0x39E8, 0x52AA, 0xAD55,
+	0xFFDE, 0x1082, 0x2104, 0x4209, 0x5AEC, 0x73AE, 0x7BEF, 0xC618, 0x0841, 0x18C3, 0x18E4, 0x2965,
+	0x528A, 0x52AB, 0x630C, 0x632C, 0x6B4D, 0x738E, 0x7BF0, 0x8410, 0x8C51, 0x9492, 0x94B2, 0x9CD3,
+	0x9CF3, 0xA514, 0xAD75, 0xB5B6, 0xC638, 0xCE58, 0xCE79, 0xD69A, 0xD6BA, 0xE71C, 0xF7BD
+};
+static const uint8_t i09dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xE2, 0x00, 0x80, 0x04, 0x80, 0x02, 0x04, 0x80, 0x02, 0x16,
+	0xD8, 0x00, 0x88, 0x02, 0x04, 0xD6, 0x00, 0x04, 0x8A, 0x02, 0xD4, 0x00, 0x1B, 0x8C, 0x02, 0xCC,
+	0x00, 0x03, 0x80, 0x05, 0x03, 0x81, 0x00, 0x13, 0x8C, 0x02, 0x0B, 0xC8, 0x00, 0x03, 0x84, 0x01,
+	0x05, 0x03, 0x2B, 0x19, 0x04, 0x8C, 0x02, 0xC7, 0x00, 0x87, 0x01, 0x06, 0x05, 0x1E, 0x22, 0x15,
+	0x8B, 0x02, 0x80, 0x00, 0x04, 0x80, 0x02, 0xC1, 0x00, 0x88, 0x01, 0x07, 0x80, 0x03, 0x30, 0x11,
+	0x15, 0x8B, 0x02, 0x04, 0x82, 0x02, 0x04, 0xBE, 0x00, 0x8A, 0x01, 0x07, 0x06, 0x03, 0x2F, 0x1A,
+	0x04, 0x91, 0x02, 0xBC, 0x00, 0x8D, 0x01, 0x18, 0x03, 0x1E, 0x0C, 0x91, 0x02, 0xBB, 0x00, 0x0F,
+	0x8D, 0x01, 0x07, 0x03, 0x39, 0x10, 0x09, 0x91, 0x02, 0xBA, 0x00, 0x8F, 0x01, 0x05, 0x03, 0x29,
+	0x11, 0x02, 0x14, 0x12, 0x13, 0x09, 0x8C, 0x02, 0xBA, 0x00, 0x90, 0x01, 0x03, 0x33, 0x19, 0x0A,
+	0x02, 0x27, 0x1C, 0x10, 0x0A, 0x14, 0x0D, 0x89, 0x02, 0xBA, 0x00, 0x90, 0x01, 0x03, 0x34, 0x24,
+	0x17, 0x0E, 0x06, 0x05, 0x37, 0x2D, 0x09, 0x12, 0x88, 0x02, 0x04, 0x80, 0x02, 0x04, 0xB7, 0x00,
+	0x90, 0x01, 0x05, 0x0E, 0x05, 0x80, 0x03, 0x80, 0x06, 0x80, 0x03, 0x38, 0x10, 0x13, 0x8C, 0x02,
+	0xB6, 0x00, 0x90, 0x01, 0x07, 0x06, 0x03, 0x07, 0x82, 0x01, 0x05, 0x03, 0x36, 0x10, 0x09, 0x8C,
+	0x02, 0xB2, 0x00, 0x0F, 0x05, 0x07, 0x99, 0x01, 0x05, 0x03, 0x2A, 0x0C, 0x8C, 0x02, 0x04, 0xAF,
+	0x00, 0x9F, 0x01, 0x03, 0x17, 0x0C, 0x04, 0x8C, 0x02, 0xAD, 0x00, 0x07, 0xA0, 0x01, 0x03, 0x1F,
+	0x08, 0x04, 0x8C, 0x02, 0xAC, 0x00, 0xA2, 0x01, 0x03, 0x32, 0x21, 0x08, 0x14, 0x0B, 0x8A, 0x02,
+	0xAB, 0x00, 0x0F, 0xA2, 0x01, 0x03, 0x31, 0x02, 0x26, 0x02, 0x80, 0x08, 0x89, 0x02, 0xAB, 0x00,
+	0xA4, 0x01, 0x0F, 0x06, 0x05, 0x0E, 0x1F, 0x25, 0x0A, 0x04, 0x86, 0x02, 0x04, 0xAA, 0x00, 0x3A,
+	0xA4, 0x01, 0x18, 0x80, 0x06, 0x80, 0x03, 0x06, 0x1D, 0x0A, 0x86, 0x02, 0x1B, 0xAA, 0x00, 0xA9,
+	0x01, 0x07, 0x80, 0x03, 0x28, 0x11, 0x84, 0x02, 0x04, 0xAB, 0x00, 0xAA, 0x01, 0x07, 0x03, 0x0E,
+	0x0A, 0x12, 0x0D, 0x81, 0x02, 0x0D, 0xAC, 0x00, 0xAB, 0x01, 0x05, 0x03, 0x17, 0x80, 0x08, 0x0D,
+	0x09, 0xAE, 0x00, 0xAB, 0x01, 0x07, 0x05, 0x03, 0xB2, 0x00, 0xAE, 0x01, 0xB2, 0x00, 0xAE, 0x01,
+	0xB2, 0x00, 0x03, 0xAD, 0x01, 0xB3, 0x00, 0x8C, 0x01, 0x05, 0x06, 0x9C, 0x01, 0x0F, 0xB4, 0x00,
+	0x89, 0x01, 0x07, 0x05, 0x81, 0x03, 0x9B, 0x01, 0xB6, 0x00, 0x88, 0x01, 0x05, 0x03, 0x2E, 0x02,
+	0x35, 0x03, 0x99, 0x01, 0xB8, 0x00, 0x86, 0x01, 0x07, 0x03, 0x0E, 0x0C, 0x20, 0x1C, 0x03, 0x18,
+	0x97, 0x01, 0xBB, 0x00, 0x84, 0x01, 0x05, 0x03, 0x2C, 0x0A, 0x08, 0x1D, 0x03, 0x05, 0x87, 0x01,
+	0x06, 0x80, 0x03, 0x06, 0x89, 0x01, 0xC4, 0x00, 0x1A, 0x04, 0x15, 0x02, 0xDE, 0x00, 0x09, 0x02,
+	0x04, 0x8B, 0x00, 0x0C, 0x23, 0xDF, 0x00, 0x08, 0x80, 0x02, 0x08, 0xD6, 0x00, 0x80, 0x02, 0x84,
+	0x00, 0x82, 0x02, 0xCD, 0x00, 0x04, 0x02, 0x0D, 0x83, 0x00, 0x82, 0x02, 0x83, 0x00, 0x81, 0x02,
+	0x04, 0xCD, 0x00, 0x82, 0x02, 0x82, 0x00, 0x04, 0x80, 0x02, 0x04, 0x83, 0x00, 0x02, 0x04, 0x02,
+	0xCD, 0x00, 0x04, 0x82, 0x02, 0x81, 0x00, 0x04, 0x81, 0x02, 0x0B, 0xD5, 0x00, 0x82, 0x02, 0x82,
+	0x00, 0x04, 0x81, 0x02, 0xD5, 0x00, 0x09, 0x82, 0x02, 0x82, 0x00, 0x82, 0x02, 0xD5, 0x00, 0x08,
+	0x81, 0x02, 0x85, 0x00, 0x16, 0xD8, 0x00, 0x04, 0x0B, 0x82, 0x00, 0x04, 0x02, 0x84, 0x00, 0x04,
+	0x81, 0x02, 0xD5, 0x00, 0x16, 0x81, 0x02, 0x83, 0x00, 0x81, 0x02, 0x04, 0xD5, 0x00, 0x82, 0x02,
+	0x82, 0x00, 0x83, 0x02, 0xD5, 0x00, 0x0B, 0x81, 0x02, 0x82, 0x00, 0x04, 0x81, 0x02, 0xD7, 0x00,
+	0x0B, 0x04, 0x83, 0x00, 0x02, 0x04, 0x80, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xE0, 0x00
+};
+
+// 'i04d', 61 colours, 637 bytes
+static const uint16_t i04dPalette[] PROGMEM = {
+	0x0000, 0xF79E, 0x4A49, 0xFFFF, 0xF7BE, 0x4229, 0x2945, 0xF79D, 0x3186, 0x4208, 0x4228, 0xFFDF,
+	0x2104, 0x39C7, 0x4A69, 0x2125, 0x31A6, 0xC638, 0xDEDB, 0x31A7, 0x39E8, 0x8410, 0x8C51, 0x9CF3,
+	0xAD75, 0xD69A, 0xDEFB, 0xE73C, 0xEF7D, 0x1082, 0x10A3, 0x18E3, 0x18E4, 0x2965, 0x2966, 0x39E7,
+	0x4209, 0x4A6A, 0x528A, 0x52AA, 0x52AB, 0x5ACC, 0x5AEB, 0x5AEC, 0x630C, 0x632D, 0x6B4D, 0x6B6D,
+	0x73AE, 0x73AF, 0x7BCF, 0x7BEF, 0x8C71, 0x9CF4, 0xA514, 0xB5B6, 0xBDF7, 0xE71C, 0xEF5D, 0xF7BD,
+	0xFFDE
+};
+static const uint8_t i04dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xF0, 0x00, 0x02, 0x05,
+	0x84, 0x02, 0xD8, 0x00, 0x8A, 0x02, 0xD5, 0x00, 0x8C, 0x02, 0xD3, 0x00, 0x8D, 0x02, 0x05, 0xD1,
+	0x00, 0x90, 0x02, 0xCF, 0x00, 0x06, 0x90, 0x02, 0x0A, 0xC4, 0x00, 0x03, 0x84, 0x01, 0x07, 0x03,
+	0x00, 0x1F, 0x0D, 0x90, 0x02, 0xC2, 0x00, 0x88, 0x01, 0x04, 0x03, 0x17, 0x21, 0x22, 0x8F, 0x02,
+	0x27, 0xC0, 0x00, 0x8A, 0x01, 0x04, 0x03, 0x19, 0x02, 0x06, 0x8E, 0x02, 0x05, 0x00, 0x83, 0x02,
+	0x15, 0xB8, 0x00, 0x8B, 0x01, 0x07, 0x04, 0x80, 0x03, 0x2C, 0x0C, 0x95, 0x02, 0x05, 0xB6, 0x00,
+	0x8F, 0x01, 0x03, 0x04, 0x28, 0x06, 0x0E, 0x94, 0x02, 0x05, 0xB4, 0x00, 0x90, 0x01, 0x07, 0x03,
+	0x1B, 0x0A, 0x0D, 0x95, 0x02, 0xB3, 0x00, 0x93, 0x01, 0x03, 0x17, 0x0C, 0x95, 0x02, 0x05, 0xB2,
+	0x00, 0x93, 0x01, 0x03, 0x01, 0x26, 0x13, 0x95, 0x02, 0xB2, 0x00, 0x94, 0x01, 0x03, 0x35, 0x06,
+	0x80, 0x02, 0x0A, 0x80, 0x09, 0x0A, 0x8F, 0x02, 0xB1, 0x00, 0x95, 0x01, 0x03, 0x19, 0x23, 0x08,
+	0x0F, 0x10, 0x09, 0x0A, 0x10, 0x0F, 0x08, 0x8D, 0x02, 0xB1, 0x00, 0x95, 0x01, 0x03, 0x1A, 0x0F,
+	0x25, 0x18, 0x11, 0x80, 0x12, 0x11, 0x18, 0x2B, 0x0C, 0x09, 0x8B, 0x02, 0x05, 0x02, 0x05, 0xAE,
+	0x00, 0x95, 0x01, 0x03, 0x1A, 0x16, 0x1C, 0x85, 0x03, 0x16, 0x08, 0x09, 0x8F, 0x02, 0xAC, 0x00,
+	0x97, 0x01, 0x03, 0x0B, 0x07, 0x82, 0x01, 0x07, 0x0B, 0x03, 0x36, 0x0C, 0x05, 0x8F, 0x02, 0xAB,
+	0x00, 0x97, 0x01, 0x04, 0x86, 0x01, 0x80, 0x03, 0x31, 0x06, 0x90, 0x02, 0xA7, 0x00, 0x3A, 0x3B,
+	0x00, 0xA0, 0x01, 0x07, 0x03, 0x39, 0x09, 0x14, 0x90, 0x02, 0xA3, 0x00, 0x03, 0xA6, 0x01, 0x04,
+	0x03, 0x2E, 0x08, 0x90, 0x02, 0xA2, 0x00, 0xA8, 0x01, 0x04, 0x03, 0x15, 0x06, 0x90, 0x02, 0xA0,
+	0x00, 0xAB, 0x01, 0x03, 0x34, 0x06, 0x90, 0x02, 0x9F, 0x00, 0x03, 0xAA, 0x01, 0x04, 0x03, 0x2F,
+	0x1D, 0x08, 0x14, 0x8D, 0x02, 0x05, 0x9F, 0x00, 0xAB, 0x01, 0x0B, 0x04, 0x30, 0x2A, 0x2D, 0x02,
+	0x80, 0x06, 0x0A, 0x8B, 0x02, 0x9E, 0x00, 0xAD, 0x01, 0x1C, 0x07, 0x80, 0x03, 0x1B, 0x37, 0x32,
+	0x08, 0x10, 0x0E, 0x89, 0x02, 0x9E, 0x00, 0xAE, 0x01, 0x0B, 0x3C, 0x0B, 0x81, 0x03, 0x38, 0x0D,
+	0x08, 0x0E, 0x88, 0x02, 0x9D, 0x00, 0xB4, 0x01, 0x04, 0x03, 0x12, 0x0D, 0x08, 0x0E, 0x86, 0x02,
+	0x9E, 0x00, 0xB6, 0x01, 0x03, 0x11, 0x13, 0x09, 0x85, 0x02, 0x9F, 0x00, 0xB6, 0x01, 0x04, 0x03,
+	0x33, 0x1E, 0x83, 0x02, 0x0A, 0xA0, 0x00, 0xB7, 0x01, 0x03, 0x01, 0x29, 0x20, 0x80, 0x02, 0x24,
+	0xA2, 0x00, 0xB7, 0x01, 0x07, 0x80, 0x03, 0xA6, 0x00, 0xB8, 0x01, 0x07, 0x03, 0xA6, 0x00, 0xBA,
+	0x01, 0xA6, 0x00, 0xBA, 0x01, 0xA7, 0x00, 0xB8, 0x01, 0x04, 0xA7, 0x00, 0xB8, 0x01, 0xA9, 0x00,
+	0xB7, 0x01, 0xA9, 0x00, 0x03, 0xB5, 0x01, 0xAB, 0x00, 0x03, 0xB3, 0x01, 0xAD, 0x00, 0x03, 0xB1,
+	0x01, 0x03, 0xAF, 0x00, 0x03, 0xAE, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xF6, 0x00
+};
+
+// 'i10d', 70 colours, 723 bytes
+static const uint16_t i10dPalette[] PROGMEM = {
+	0x0000, 0xF79E, 0xEB69, 0x4A49, 0xF7DF, 0xFFFF, 0xF7BE, 0x4229, 0xEB89, 0x4228, 0xEA86, 0xEAA6,
+	0xF7BF, 0xEA66, 0x4A29, 0xEB28, 0x3186, 0x4208, 0x8410, 0xEA25, 0xEAE7, 0xEB07, 0xEC8E, 0x31A7,
+	0x4A69, 0xEB08, 0xEB49, 0xEB8A, 0xEBAA, 0xEBEB, 0xEF5D, 0xEF7D, 0xEFDF, 0xF551, 0xF572, 0xF698,
+	0xF6FA, 0xF71B, 0xF75C, 0xFFDF, 0x2124, 0x2965, 0x2986, 0x39E7, 0x4209, 0x62EC, 0x6B6D, 0xA514,
+	0xC638, 0xE1E4, 0xE38A, 0xEA05, 0xEA45, 0xEA65, 0xEAC7, 0xEBA9, 0xEC4C, 0xECAE, 0xED10, 0xEF7E,
+	0xF4CF, 0xF510, 0xF592, 0xF5B3, 0xF5D4, 0xF636, 0xF656, 0xF6B8, 0xF6DA, 0xFC0A
+};
+static const uint8_t i10dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xE8, 0x00, 0x87, 0x02, 0x1A, 0xD6, 0x00, 0x8C, 0x02, 0xD3,
+	0x00, 0x8E, 0x02, 0x37, 0xCF, 0x00, 0x92, 0x02, 0xC3, 0x00, 0x06, 0x83, 0x01, 0x1E, 0x81, 0x00,
+	0x15, 0x93, 0x02, 0xC0, 0x00, 0x88, 0x01, 0x80, 0x00, 0x0A, 0x93, 0x02, 0x45, 0xBD, 0x00, 0x1F,
+	0x89, 0x01, 0x04, 0x21, 0x31, 0x08, 0x93, 0x02, 0xBC, 0x00, 0x06, 0x8A, 0x01, 0x80, 0x0C, 0x38,
+	0x0D, 0x08, 0x93, 0x02, 0xBB, 0x00, 0x8C, 0x01, 0x80, 0x04, 0x1C, 0x0B, 0x08, 0x92, 0x02, 0xBA,
+	0x00, 0x8E, 0x01, 0x04, 0x23, 0x0D, 0x94, 0x02, 0xB8, 0x00, 0x05, 0x8E, 0x01, 0x06, 0x04, 0x16,
+	0x0A, 0x93, 0x02, 0xB8, 0x00, 0x90, 0x01, 0x04, 0x23, 0x0B, 0x19, 0x0B, 0x80, 0x0D, 0x0A, 0x19,
+	0x8D, 0x02, 0xB8, 0x00, 0x90, 0x01, 0x04, 0x25, 0x13, 0x0F, 0x16, 0x22, 0x3E, 0x39, 0x1C, 0x0A,
+	0x1A, 0x08, 0x8A, 0x02, 0xB8, 0x00, 0x90, 0x01, 0x04, 0x24, 0x3A, 0x26, 0x82, 0x04, 0x01, 0x21,
+	0x13, 0x0F, 0x08, 0x89, 0x02, 0xB8, 0x00, 0x92, 0x01, 0x80, 0x04, 0x06, 0x81, 0x01, 0x80, 0x04,
+	0x22, 0x0B, 0x8A, 0x02, 0xB8, 0x00, 0x92, 0x01, 0x06, 0x84, 0x01, 0x0C, 0x20, 0x16, 0x0A, 0x89,
+	0x02, 0xB4, 0x00, 0x9E, 0x01, 0x04, 0x42, 0x0D, 0x89, 0x02, 0xB2, 0x00, 0xA0, 0x01, 0x04, 0x26,
+	0x02, 0x0F, 0x88, 0x02, 0xB1, 0x00, 0xA1, 0x01, 0x04, 0x06, 0x1D, 0x15, 0x88, 0x02, 0xB0, 0x00,
+	0xA2, 0x01, 0x04, 0x44, 0x33, 0x13, 0x0A, 0x14, 0x02, 0x08, 0x83, 0x02, 0x32, 0xAF, 0x00, 0xA3,
+	0x01, 0x0C, 0x43, 0x3D, 0x3F, 0x3C, 0x1D, 0x0B, 0x14, 0x1B, 0x82, 0x02, 0xB0, 0x00, 0xA4, 0x01,
+	0x0C, 0x81, 0x04, 0x0C, 0x41, 0x14, 0x0B, 0x1B, 0x80, 0x02, 0x0F, 0xAF, 0x00, 0xA9, 0x01, 0x04,
+	0x20, 0x24, 0x15, 0x36, 0x08, 0x02, 0xB0, 0x00, 0xAB, 0x01, 0x04, 0x25, 0x35, 0x34, 0xB1, 0x00,
+	0xAC, 0x01, 0x04, 0x40, 0xB2, 0x00, 0xAD, 0x01, 0x04, 0xB2, 0x00, 0xAE, 0x01, 0x05, 0xB1, 0x00,
+	0xAE, 0x01, 0x1E, 0xB1, 0x00, 0xAE, 0x01, 0x05, 0xB2, 0x00, 0xAD, 0x01, 0xB3, 0x00, 0x8C, 0x01,
+	0x06, 0x27, 0x9D, 0x01, 0xB4, 0x00, 0x8A, 0x01, 0x06, 0x05, 0x27, 0x05, 0x9B, 0x01, 0xB6, 0x00,
+	0x88, 0x01, 0x06, 0x05, 0x12, 0x11, 0x2F, 0x05, 0x99, 0x01, 0x05, 0xB7, 0x00, 0x87, 0x01, 0x05,
+	0x30, 0x29, 0x28, 0x2D, 0x05, 0x06, 0x97, 0x01, 0xBB, 0x00, 0x1F, 0x83, 0x01, 0x06, 0x05, 0x2E,
+	0x10, 0x17, 0x12, 0x05, 0x80, 0x01, 0x80, 0x06, 0x83, 0x01, 0x3B, 0x82, 0x05, 0x06, 0x86, 0x01,
+	0x06, 0x05, 0xC4, 0x00, 0x17, 0x07, 0x11, 0x2C, 0xDF, 0x00, 0x18, 0x07, 0x8B, 0x00, 0x2A, 0x10,
+	0xDF, 0x00, 0x2B, 0x80, 0x03, 0x07, 0xD5, 0x00, 0x10, 0x80, 0x03, 0x09, 0x83, 0x00, 0x82, 0x03,
+	0xCD, 0x00, 0x81, 0x03, 0x83, 0x00, 0x82, 0x03, 0x83, 0x00, 0x81, 0x03, 0x07, 0xCD, 0x00, 0x0E,
+	0x80, 0x03, 0x07, 0x82, 0x00, 0x82, 0x03, 0x84, 0x00, 0x80, 0x03, 0xCD, 0x00, 0x0E, 0x81, 0x03,
+	0x07, 0x81, 0x00, 0x09, 0x82, 0x03, 0xD5, 0x00, 0x82, 0x03, 0x82, 0x00, 0x0E, 0x81, 0x03, 0xD6,
+	0x00, 0x81, 0x03, 0x09, 0x82, 0x00, 0x03, 0x0E, 0x80, 0x03, 0xD6, 0x00, 0x81, 0x03, 0x8B, 0x00,
+	0x12, 0xD2, 0x00, 0x09, 0x03, 0x82, 0x00, 0x09, 0x03, 0x11, 0x83, 0x00, 0x82, 0x03, 0xD5, 0x00,
+	0x18, 0x81, 0x03, 0x83, 0x00, 0x82, 0x03, 0xD5, 0x00, 0x82, 0x03, 0x82, 0x00, 0x83, 0x03, 0xD5,
+	0x00, 0x09, 0x81, 0x03, 0x82, 0x00, 0x82, 0x03, 0xD8, 0x00, 0x07, 0x83, 0x00, 0x82, 0x03, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDE, 0x00
+};
+
+// 'i10n', 56 colours, 701 bytes
+static const uint16_t i10nPalette[] PROGMEM = {
+	0x0000, 0xF79E, 0x4A49, 0xFFFF, 0xF7BE, 0x4A29, 0x31A7, 0x4208, 0x4228, 0x4229, 0x3186, 0xFFDF,
+	0x4A69, 0x8410, 0x39C7, 0xEF5D, 0x2986, 0x31A6, 0x39E7, 0xC638, 0x2965, 0x2966, 0x31C7, 0x39E8,
+	0x528A, 0x630C, 0x736D, 0xEF7D, 0xEF7E, 0xF7DF, 0x2124, 0x2945, 0x4209, 0x420A, 0x5AAB, 0x62EC,
+	0x6B2C, 0x6B4D, 0x6B6D, 0x736E, 0x7BCF, 0x83EF, 0x8C30, 0x8C51, 0x9492, 0xA4F3, 0xA514, 0xAD34,
+	0xB575, 0xB596, 0xB5B6, 0xC5F8, 0xCE38, 0xD6BA, 0xDEBB, 0xDEDB
+};
+static const uint8_t i10nData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xE8, 0x00, 0x80, 0x02, 0x05, 0x84, 0x02, 0x08, 0xD6, 0x00,
+	0x05, 0x8A, 0x02, 0x05, 0xD2, 0x00, 0x8E, 0x02, 0x05, 0x21, 0xCF, 0x00, 0x92, 0x02, 0xC3, 0x00,
+	0x04, 0x83, 0x01, 0x0F, 0x81, 0x00, 0x07, 0x92, 0x02, 0x05, 0xC0, 0x00, 0x87, 0x01, 0x1D, 0x80,
+	0x00, 0x0E, 0x94, 0x02, 0xBD, 0x00, 0x1B, 0x89, 0x01, 0x03, 0x0D, 0x1F, 0x94, 0x02, 0x07, 0xBB,
+	0x00, 0x04, 0x8A, 0x01, 0x0B, 0x04, 0x22, 0x11, 0x93, 0x02, 0x05, 0xBB, 0x00, 0x8B, 0x01, 0x1C,
+	0x03, 0x0B, 0x02, 0x16, 0x93, 0x02, 0xBA, 0x00, 0x8E, 0x01, 0x03, 0x31, 0x0A, 0x94, 0x02, 0xB8,
+	0x00, 0x03, 0x8E, 0x01, 0x04, 0x03, 0x19, 0x06, 0x93, 0x02, 0xB8, 0x00, 0x90, 0x01, 0x03, 0x30,
+	0x06, 0x07, 0x16, 0x11, 0x0A, 0x06, 0x07, 0x8D, 0x02, 0xB8, 0x00, 0x90, 0x01, 0x03, 0x35, 0x15,
+	0x07, 0x24, 0x0D, 0x2A, 0x25, 0x02, 0x11, 0x09, 0x8B, 0x02, 0xB8, 0x00, 0x90, 0x01, 0x03, 0x34,
+	0x1A, 0x36, 0x82, 0x03, 0x0F, 0x28, 0x15, 0x08, 0x8A, 0x02, 0xB8, 0x00, 0x91, 0x01, 0x0F, 0x80,
+	0x03, 0x04, 0x80, 0x01, 0x04, 0x80, 0x03, 0x29, 0x06, 0x8A, 0x02, 0xB8, 0x00, 0x91, 0x01, 0x80,
+	0x04, 0x84, 0x01, 0x0B, 0x03, 0x19, 0x06, 0x89, 0x02, 0xB4, 0x00, 0x9E, 0x01, 0x03, 0x2F, 0x0A,
+	0x89, 0x02, 0xB2, 0x00, 0xA0, 0x01, 0x03, 0x37, 0x08, 0x07, 0x88, 0x02, 0xB1, 0x00, 0xA1, 0x01,
+	0x03, 0x01, 0x18, 0x17, 0x88, 0x02, 0xB0, 0x00, 0xA2, 0x01, 0x03, 0x33, 0x14, 0x10, 0x06, 0x12,
+	0x85, 0x02, 0x0C, 0xAF, 0x00, 0xA3, 0x01, 0x03, 0x32, 0x27, 0x2B, 0x1A, 0x18, 0x06, 0x17, 0x83,
+	0x02, 0xB0, 0x00, 0xA4, 0x01, 0x04, 0x81, 0x03, 0x1D, 0x2D, 0x80, 0x0E, 0x0C, 0x80, 0x02, 0x0C,
+	0xAF, 0x00, 0xA9, 0x01, 0x0B, 0x03, 0x13, 0x12, 0x0E, 0x02, 0x05, 0xB0, 0x00, 0xAB, 0x01, 0x03,
+	0x13, 0x10, 0x0A, 0xB1, 0x00, 0xAB, 0x01, 0x04, 0x03, 0x2C, 0xB2, 0x00, 0xAD, 0x01, 0x03, 0xB2,
+	0x00, 0xAE, 0x01, 0x03, 0xB1, 0x00, 0xAE, 0x01, 0x0F, 0xB1, 0x00, 0xAE, 0x01, 0x03, 0xB2, 0x00,
+	0xAD, 0x01, 0xB3, 0x00, 0x8C, 0x01, 0x04, 0x0B, 0x9D, 0x01, 0xB4, 0x00, 0x8A, 0x01, 0x04, 0x03,
+	0x0B, 0x03, 0x9B, 0x01, 0xB6, 0x00, 0x88, 0x01, 0x04, 0x03, 0x0D, 0x07, 0x2E, 0x03, 0x99, 0x01,
+	0x03, 0xB7, 0x00, 0x87, 0x01, 0x03, 0x13, 0x14, 0x1E, 0x23, 0x03, 0x04, 0x97, 0x01, 0xBB, 0x00,
+	0x1B, 0x83, 0x01, 0x04, 0x03, 0x26, 0x0A, 0x06, 0x0D, 0x03, 0x80, 0x01, 0x80, 0x04, 0x83, 0x01,
+	0x1C, 0x82, 0x03, 0x04, 0x86, 0x01, 0x04, 0x03, 0xC4, 0x00, 0x06, 0x09, 0x07, 0x20, 0xDF, 0x00,
+	0x0C, 0x09, 0x8B, 0x00, 0x10, 0x0A, 0xDF, 0x00, 0x12, 0x80, 0x02, 0x09, 0xD5, 0x00, 0x0A, 0x80,
+	0x02, 0x08, 0x83, 0x00, 0x82, 0x02, 0xCD, 0x00, 0x81, 0x02, 0x83, 0x00, 0x82, 0x02, 0x83, 0x00,
+	0x81, 0x02, 0x09, 0xCD, 0x00, 0x05, 0x80, 0x02, 0x09, 0x82, 0x00, 0x82, 0x02, 0x84, 0x00, 0x80,
+	0x02, 0xCD, 0x00, 0x05, 0x81, 0x02, 0x09, 0x81, 0x00, 0x08, 0x82, 0x02, 0xD5, 0x00, 0x82, 0x02,
+	0x82, 0x00, 0x05, 0x81, 0x02, 0xD6, 0x00, 0x81, 0x02, 0x08, 0x82, 0x00, 0x02, 0x05, 0x80, 0x02,
+	0xD6, 0x00, 0x81, 0x02, 0x8B, 0x00, 0x0D, 0xD2, 0x00, 0x08, 0x02, 0x82, 0x00, 0x08, 0x02, 0x07,
+	0x83, 0x00, 0x82, 0x02, 0xD5, 0x00, 0x0C, 0x81, 0x02, 0x83, 0x00, 0x82, 0x02, 0xD5, 0x00, 0x82,
+	0x02, 0x82, 0x00, 0x83, 0x02, 0xD5, 0x00, 0x08, 0x81, 0x02, 0x82, 0x00, 0x82, 0x02, 0xD8, 0x00,
+	0x09, 0x83, 0x00, 0x82, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xDE, 0x00
+};
+
+// 'i11d', 98 colours, 913 bytes
+static const uint16_t i11dPalette[] PROGMEM = {
+	0x0000, 0xF79E, 0x4A49, 0xEB69, 0xFFFF, 0xF7FF, 0xEF5D, 0xF7BE, 0x4229, 0xF79D, 0x3186, 0xEAA5,
+	0x2945, 0x4208, 0x39C7, 0x4228, 0x4A69, 0xEB89, 0xEB28, 0xED11, 0x2965, 0xEB48, 0xF73C, 0xF7BD,
+	0x2125, 0x31A7, 0x8410, 0xEA85, 0xEAC6, 0xEAE7, 0xEB07, 0xEBAA, 0xED52, 0xEF7D, 0xEFFF, 0xF7DF,
+	0xFFDE, 0xFFDF, 0x2966, 0x31A6, 0x4209, 0x52AA, 0x73AF, 0xAD75, 0xB596, 0xB5B6, 0xBDF7, 0xD69A,
+	0xDEDB, 0xE73C, 0xEB49, 0xEB8A, 0xF6DA, 0xF75C, 0x1082, 0x18C3, 0x18E4, 0x2104, 0x2124, 0x39E8,
+	0x5AEB, 0x630C, 0x738E, 0x73AE, 0x8C71, 0x8C72, 0x9492, 0x94B2, 0x9CD3, 0x9CF3, 0xAD55, 0xBDD7,
+	0xC618, 0xC638, 0xCE59, 0xCE79, 0xE285, 0xE369, 0xE9E1, 0xEA64, 0xEA84, 0xEBEB, 0xEC2D, 0xECAF,
+	0xECD0, 0xECF1, 0xEDB4, 0xEDD5, 0xEDF5, 0xEF5C, 0xF5D5, 0xF6B9, 0xF6FB, 0xF71A, 0xF71B, 0xF75D,
+	0xF7BF, 0xF7DE
+};
+static const uint8_t i11dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0x9B, 0x00, 0x29, 0x83, 0x02, 0x08, 0x02, 0x0F, 0xD8, 0x00, 0x08, 0x87,
+	0x02, 0x08, 0xD5, 0x00, 0x1A, 0x8C, 0x02, 0xD2, 0x00, 0x8E, 0x02, 0xD2, 0x00, 0x08, 0x8E, 0x02,
+	0xC9, 0x00, 0x04, 0x31, 0x04, 0x82, 0x00, 0x38, 0x8F, 0x02, 0x08, 0xC4, 0x00, 0x04, 0x86, 0x01,
+	0x80, 0x04, 0x3A, 0x19, 0x10, 0x8E, 0x02, 0xC3, 0x00, 0x88, 0x01, 0x24, 0x04, 0x44, 0x0A, 0x27,
+	0x10, 0x8D, 0x02, 0x0D, 0x80, 0x00, 0x0F, 0x28, 0xBD, 0x00, 0x89, 0x01, 0x09, 0x07, 0x04, 0x4A,
+	0x80, 0x0A, 0x10, 0x8C, 0x02, 0x28, 0x08, 0x83, 0x02, 0x29, 0xB8, 0x00, 0x04, 0x8C, 0x01, 0x07,
+	0x04, 0x30, 0x0E, 0x0A, 0x94, 0x02, 0x08, 0xB7, 0x00, 0x8F, 0x01, 0x04, 0x48, 0x14, 0x0D, 0x94,
+	0x02, 0x0F, 0xB5, 0x00, 0x91, 0x01, 0x04, 0x45, 0x18, 0x95, 0x02, 0xB4, 0x00, 0x21, 0x91, 0x01,
+	0x04, 0x01, 0x08, 0x0E, 0x94, 0x02, 0x10, 0xB3, 0x00, 0x93, 0x01, 0x04, 0x41, 0x18, 0x80, 0x02,
+	0x08, 0x0F, 0x80, 0x08, 0x8E, 0x02, 0x08, 0xB3, 0x00, 0x93, 0x01, 0x04, 0x2F, 0x80, 0x0E, 0x0C,
+	0x26, 0x80, 0x0A, 0x0C, 0x26, 0x08, 0x8D, 0x02, 0xB3, 0x00, 0x93, 0x01, 0x04, 0x07, 0x3B, 0x14,
+	0x42, 0x2D, 0x80, 0x2E, 0x2B, 0x2A, 0x0C, 0x0A, 0x10, 0x8B, 0x02, 0x08, 0x0F, 0xB0, 0x00, 0x07,
+	0x93, 0x01, 0x80, 0x07, 0x43, 0x49, 0x84, 0x04, 0x2D, 0x08, 0x0A, 0x10, 0x8C, 0x02, 0x08, 0x02,
+	0xAE, 0x00, 0x17, 0x94, 0x01, 0x21, 0x80, 0x04, 0x82, 0x01, 0x09, 0x07, 0x04, 0x59, 0x0D, 0x0A,
+	0x8F, 0x02, 0xAD, 0x00, 0x06, 0x95, 0x01, 0x07, 0x86, 0x01, 0x04, 0x4B, 0x27, 0x0D, 0x8F, 0x02,
+	0xAA, 0x00, 0x04, 0x31, 0x04, 0x9E, 0x01, 0x07, 0x04, 0x3E, 0x14, 0x90, 0x02, 0xA6, 0x00, 0xA5,
+	0x01, 0x04, 0x2B, 0x0C, 0x08, 0x8F, 0x02, 0xA4, 0x00, 0xA7, 0x01, 0x04, 0x2F, 0x0E, 0x0D, 0x8F,
+	0x02, 0xA3, 0x00, 0x09, 0xA7, 0x01, 0x04, 0x30, 0x80, 0x0D, 0x8F, 0x02, 0xA2, 0x00, 0x17, 0xA8,
+	0x01, 0x04, 0x2C, 0x36, 0x18, 0x0C, 0x19, 0x8D, 0x02, 0xA1, 0x00, 0xAA, 0x01, 0x25, 0x47, 0x2A,
+	0x40, 0x1A, 0x3C, 0x0C, 0x19, 0x8B, 0x02, 0xA1, 0x00, 0xAA, 0x01, 0x09, 0x25, 0x81, 0x04, 0x24,
+	0x2C, 0x02, 0x0C, 0x8A, 0x02, 0xA0, 0x00, 0x21, 0xAC, 0x01, 0x07, 0x80, 0x01, 0x80, 0x04, 0x07,
+	0x3F, 0x39, 0x88, 0x02, 0x1A, 0xA0, 0x00, 0xB1, 0x01, 0x09, 0x80, 0x04, 0x3D, 0x14, 0x87, 0x02,
+	0xA1, 0x00, 0xB2, 0x01, 0x09, 0x04, 0x25, 0x0F, 0x0A, 0x85, 0x02, 0xA2, 0x00, 0xB4, 0x01, 0x04,
+	0x46, 0x37, 0x0E, 0x81, 0x02, 0x08, 0xA4, 0x00, 0x90, 0x01, 0x09, 0x01, 0x85, 0x05, 0x07, 0x09,
+	0x98, 0x01, 0x04, 0xAA, 0x00, 0x90, 0x01, 0x07, 0x05, 0x5A, 0x55, 0x81, 0x20, 0x80, 0x13, 0x5F,
+	0x23, 0x98, 0x01, 0x24, 0x04, 0xA9, 0x00, 0x8F, 0x01, 0x09, 0x05, 0x16, 0x0B, 0x4F, 0x80, 0x0B,
+	0x1C, 0x4E, 0x51, 0x07, 0x23, 0x9A, 0x01, 0xA9, 0x00, 0x8F, 0x01, 0x07, 0x05, 0x13, 0x0B, 0x81,
+	0x03, 0x80, 0x1E, 0x35, 0x05, 0x09, 0x9A, 0x01, 0xA9, 0x00, 0x04, 0x8E, 0x01, 0x05, 0x34, 0x1C,
+	0x15, 0x81, 0x03, 0x1B, 0x56, 0x05, 0x9B, 0x01, 0x04, 0xAA, 0x00, 0x8E, 0x01, 0x05, 0x54, 0x50,
+	0x11, 0x03, 0x11, 0x0B, 0x52, 0x05, 0x23, 0x9B, 0x01, 0xAB, 0x00, 0x04, 0x8B, 0x01, 0x09, 0x05,
+	0x35, 0x80, 0x12, 0x80, 0x03, 0x15, 0x0B, 0x5B, 0x05, 0x09, 0x9B, 0x01, 0xAC, 0x00, 0x17, 0x8A,
+	0x01, 0x07, 0x05, 0x53, 0x0B, 0x11, 0x80, 0x03, 0x0B, 0x57, 0x81, 0x05, 0x60, 0x09, 0x98, 0x01,
+	0xAE, 0x00, 0x8A, 0x01, 0x05, 0x5E, 0x1D, 0x15, 0x80, 0x03, 0x12, 0x1F, 0x16, 0x09, 0x16, 0x5C,
+	0x16, 0x07, 0x97, 0x01, 0xB0, 0x00, 0x04, 0x87, 0x01, 0x07, 0x05, 0x13, 0x1B, 0x81, 0x03, 0x32,
+	0x80, 0x1F, 0x80, 0x03, 0x1B, 0x58, 0x05, 0x96, 0x01, 0xB3, 0x00, 0x84, 0x01, 0x09, 0x07, 0x05,
+	0x34, 0x1C, 0x15, 0x83, 0x03, 0x80, 0x12, 0x0B, 0x13, 0x61, 0x07, 0x94, 0x01, 0x17, 0xB8, 0x00,
+	0x80, 0x06, 0x80, 0x22, 0x04, 0x03, 0x1D, 0x11, 0x84, 0x03, 0x32, 0x1D, 0x5D, 0x22, 0x93, 0x06,
+	0xBF, 0x00, 0x4C, 0x1E, 0x33, 0x86, 0x03, 0xD7, 0x00, 0x88, 0x03, 0x11, 0xDB, 0x00, 0x84, 0x03,
+	0xDC, 0x00, 0x83, 0x03, 0xDC, 0x00, 0x83, 0x03, 0xDD, 0x00, 0x82, 0x03, 0xDD, 0x00, 0x11, 0x81,
+	0x03, 0xDE, 0x00, 0x81, 0x03, 0x33, 0xDD, 0x00, 0x82, 0x03, 0xDE, 0x00, 0x81, 0x03, 0xDE, 0x00,
+	0x4D, 0x80, 0x03, 0xDF, 0x00, 0x80, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xAB, 0x00
+};
+
+// 'i13d', 11 colours, 679 bytes
+static const uint16_t i13dPalette[] PROGMEM = {
+	0x0000, 0x4A49, 0x4229, 0x4228, 0x52AA, 0x8410, 0x3186, 0x4208, 0x4A69, 0x4209, 0x420A
+};
+static const uint8_t i13dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xCF, 0x00,
+	0x81, 0x01, 0x02, 0xDE, 0x00, 0x82, 0x01, 0xD9, 0x00, 0x03, 0x01, 0x81, 0x00, 0x82, 0x01, 0x07,
+	0x80, 0x00, 0x80, 0x01, 0xD3, 0x00, 0x02, 0x81, 0x01, 0x80, 0x00, 0x82, 0x01, 0x80, 0x00, 0x82,
+	0x01, 0xD2, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x81, 0x01, 0x00, 0x83, 0x01, 0xCE, 0x00, 0x80,
+	0x02, 0x80, 0x00, 0x02, 0x82, 0x01, 0x02, 0x88, 0x01, 0x80, 0x00, 0x02, 0x01, 0x07, 0xC8, 0x00,
+	0x02, 0x81, 0x01, 0x80, 0x00, 0x8B, 0x01, 0x02, 0x80, 0x00, 0x82, 0x01, 0xC8, 0x00, 0x82, 0x01,
+	0x81, 0x00, 0x8A, 0x01, 0x81, 0x00, 0x82, 0x01, 0xC8, 0x00, 0x02, 0x81, 0x01, 0x02, 0x81, 0x00,
+	0x87, 0x01, 0x02, 0x82, 0x00, 0x82, 0x01, 0xC3, 0x00, 0x80, 0x01, 0x02, 0x80, 0x00, 0x82, 0x01,
+	0x02, 0x82, 0x00, 0x02, 0x85, 0x01, 0x82, 0x00, 0x02, 0x81, 0x01, 0x02, 0x80, 0x00, 0x80, 0x01,
+	0x02, 0xBE, 0x00, 0x82, 0x01, 0x02, 0x07, 0x81, 0x01, 0x02, 0x83, 0x00, 0x02, 0x83, 0x01, 0x83,
+	0x00, 0x83, 0x01, 0x00, 0x82, 0x01, 0x02, 0xBC, 0x00, 0x89, 0x01, 0x08, 0x83, 0x00, 0x82, 0x01,
+	0x04, 0x83, 0x00, 0x88, 0x01, 0x02, 0xBD, 0x00, 0x88, 0x01, 0x02, 0x83, 0x00, 0x82, 0x01, 0x05,
+	0x82, 0x00, 0x02, 0x88, 0x01, 0xBF, 0x00, 0x88, 0x01, 0x83, 0x00, 0x82, 0x01, 0x83, 0x00, 0x02,
+	0x87, 0x01, 0xC2, 0x00, 0x86, 0x01, 0x02, 0x81, 0x00, 0x83, 0x01, 0x02, 0x81, 0x00, 0x07, 0x86,
+	0x01, 0xC1, 0x00, 0x06, 0x93, 0x01, 0x08, 0x88, 0x01, 0x02, 0x80, 0x01, 0xBD, 0x00, 0x02, 0xA2,
+	0x01, 0x02, 0xBC, 0x00, 0x99, 0x01, 0x02, 0x88, 0x01, 0xBC, 0x00, 0x85, 0x01, 0x03, 0x05, 0x80,
+	0x00, 0x02, 0x84, 0x01, 0x80, 0x00, 0x02, 0x83, 0x01, 0x02, 0x81, 0x00, 0x03, 0x80, 0x02, 0x83,
+	0x01, 0xBC, 0x00, 0x01, 0x02, 0x80, 0x01, 0x86, 0x00, 0x82, 0x01, 0x02, 0x82, 0x00, 0x82, 0x01,
+	0x02, 0x86, 0x00, 0x82, 0x01, 0xC8, 0x00, 0x02, 0x82, 0x01, 0x82, 0x00, 0x83, 0x01, 0xC9, 0x00,
+	0x02, 0x01, 0x04, 0x86, 0x00, 0x09, 0x82, 0x01, 0x82, 0x00, 0x83, 0x01, 0x87, 0x00, 0x80, 0x01,
+	0x06, 0xBC, 0x00, 0x84, 0x01, 0x03, 0x04, 0x81, 0x00, 0x0A, 0x84, 0x01, 0x80, 0x00, 0x08, 0x83,
+	0x01, 0x03, 0x82, 0x00, 0x03, 0x02, 0x83, 0x01, 0xBC, 0x00, 0x87, 0x01, 0x02, 0x87, 0x01, 0x02,
+	0x90, 0x01, 0xBC, 0x00, 0xA4, 0x01, 0xBD, 0x00, 0x02, 0x80, 0x01, 0x80, 0x02, 0x8E, 0x01, 0x02,
+	0x8C, 0x01, 0xC1, 0x00, 0x02, 0x86, 0x01, 0x81, 0x00, 0x84, 0x01, 0x81, 0x00, 0x87, 0x01, 0xC2,
+	0x00, 0x04, 0x02, 0x86, 0x01, 0x83, 0x00, 0x82, 0x01, 0x05, 0x82, 0x00, 0x02, 0x87, 0x01, 0xBF,
+	0x00, 0x02, 0x88, 0x01, 0x83, 0x00, 0x82, 0x01, 0x05, 0x82, 0x00, 0x02, 0x88, 0x01, 0xBD, 0x00,
+	0x89, 0x01, 0x02, 0x83, 0x00, 0x82, 0x01, 0x04, 0x83, 0x00, 0x88, 0x01, 0x02, 0xBC, 0x00, 0x04,
+	0x83, 0x01, 0x05, 0x82, 0x01, 0x83, 0x00, 0x84, 0x01, 0x83, 0x00, 0x02, 0x82, 0x01, 0x02, 0x83,
+	0x01, 0xBD, 0x00, 0x02, 0x81, 0x01, 0x00, 0x82, 0x01, 0x02, 0x82, 0x00, 0x02, 0x84, 0x01, 0x02,
+	0x82, 0x00, 0x83, 0x01, 0x80, 0x00, 0x01, 0x02, 0x01, 0xC3, 0x00, 0x83, 0x01, 0x81, 0x00, 0x02,
+	0x87, 0x01, 0x81, 0x00, 0x06, 0x81, 0x01, 0x02, 0xC8, 0x00, 0x82, 0x01, 0x81, 0x00, 0x02, 0x89,
+	0x01, 0x81, 0x00, 0x82, 0x01, 0xC8, 0x00, 0x82, 0x01, 0x80, 0x00, 0x8C, 0x01, 0x80, 0x00, 0x02,
+	0x81, 0x01, 0xC8, 0x00, 0x08, 0x81, 0x01, 0x00, 0x87, 0x01, 0x02, 0x83, 0x01, 0x02, 0x80, 0x00,
+	0x02, 0x01, 0x02, 0xCD, 0x00, 0x02, 0x82, 0x01, 0x00, 0x82, 0x01, 0x00, 0x02, 0x82, 0x01, 0xD2,
+	0x00, 0x02, 0x80, 0x01, 0x02, 0x80, 0x00, 0x82, 0x01, 0x80, 0x00, 0x82, 0x01, 0xD3, 0x00, 0x80,
+	0x01, 0x06, 0x80, 0x00, 0x83, 0x01, 0x80, 0x00, 0x02, 0x01, 0x03, 0xD8, 0x00, 0x82, 0x01, 0xDE,
+	0x00, 0x82, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+	0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xEC,
+	0x00
+};
+
+// 'i50d', 9 colours, 256 bytes
+static const uint16_t i50dPalette[] PROGMEM = {
+	0x0000, 0x4A49, 0x4229, 0x4A69, 0x4228, 0x3186, 0x4208, 0x4209, 0x528A
+};
+static const uint8_t i50dData[] PROGMEM = {
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xD2, 0x00, 0x02, 0x90, 0x01, 0xCF, 0x00, 0x90, 0x01, 0x02, 0xCF, 0x00,
+	0x03, 0x02, 0x8E, 0x01, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xED, 0x00, 0xA0, 0x01, 0xC0, 0x00, 0xA0,
+	0x01, 0xC0, 0x00, 0xA0, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xF5, 0x00, 0x08, 0xA2, 0x01, 0x81, 0x02,
+	0xBA, 0x00, 0xA6, 0x01, 0xBA, 0x00, 0xA6, 0x01, 0xBB, 0x00, 0x01, 0xA1, 0x02, 0x01, 0x02, 0x03,
+	0xFF, 0x00, 0xF3, 0x00, 0x02, 0x01, 0x02, 0xA3, 0x01, 0xBA, 0x00, 0xA6, 0x01, 0xBA, 0x00, 0xA6,
+	0x01, 0xBA, 0x00, 0x05, 0xA2, 0x02, 0x80, 0x01, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x88, 0x00, 0x04,
+	0xA2, 0x01, 0x81, 0x02, 0xBA, 0x00, 0xA6, 0x01, 0x07, 0xB9, 0x00, 0xA6, 0x01, 0x06, 0xBA, 0x00,
+	0x01, 0x02, 0xA0, 0x01, 0x80, 0x02, 0x04, 0xFF, 0x00, 0xFF, 0x00, 0x86, 0x00, 0x04, 0x97, 0x01,
+	0xC8, 0x00, 0x97, 0x01, 0x02, 0xC8, 0x00, 0x97, 0x01, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+	0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xEE, 0x00
+};
+
+// Indexed by WeatherIconId
+const PackedIcon weatherIcons[WEATHER_ICON_COUNT] = {
+    {100, 100, sizeof(i01dPalette) / sizeof(uint16_t), i01dPalette, i01dData, sizeof(i01dData)},
+    {100, 100, sizeof(i01nPalette) / sizeof(uint16_t), i01nPalette, i01nData, sizeof(i01nData)},
+    {100, 100, sizeof(i02dPalette) / sizeof(uint16_t), i02dPalette, i02dData, sizeof(i02dData)},
+    {100, 100, sizeof(i02nPalette) / sizeof(uint16_t), i02nPalette, i02nData, sizeof(i02nData)},
+    {100, 100, sizeof(i03dPalette) / sizeof(uint16_t), i03dPalette, i03dData, sizeof(i03dData)},
+    {100, 100, sizeof(i09dPalette) / sizeof(uint16_t), i09dPalette, i09dData, sizeof(i09dData)},
+    {100, 100, sizeof(i04dPalette) / sizeof(uint16_t), i04dPalette, i04dData, sizeof(i04dData)},
+    {100, 100, sizeof(i10dPalette) / sizeof(uint16_t), i10dPalette, i10dData, sizeof(i10dData)},
+    {100, 100, sizeof(i10nPalette) / sizeof(uint16_t), i10nPalette, i10nData, sizeof(i10nData)},
+    {100, 100, sizeof(i11dPalette) / sizeof(uint16_t), i11dPalette, i11dData, sizeof(i11dData)},
+    {100, 100, sizeof(i13dPalette) / sizeof(uint16_t), i13dPalette, i13dData, sizeof(i13dData)},
+    {100, 100, sizeof(i50dPalette) / sizeof(uint16_t), i50dPalette, i50dData, sizeof(i50dData)},
+};
+
+static_assert(ICON_01D == 0, "WeatherIconId order");
+static_assert(ICON_01N == 1, "WeatherIconId order");
+static_assert(ICON_02D == 2, "WeatherIconId order");
+static_assert(ICON_02N == 3, "WeatherIconId order");
+static_assert(ICON_03D == 4, "WeatherIconId order");
+static_assert(ICON_09D == 5, "WeatherIconId order");
+static_assert(ICON_04D == 6, "WeatherIconId order");
+static_assert(ICON_10D == 7, "WeatherIconId order");
+static_assert(ICON_10N == 8, "WeatherIconId order");
+static_assert(ICON_11D == 9, "WeatherIconId order");
+static_assert(ICON_13D == 10, "WeatherIconId order");
+static_assert(ICON_50D == 11, "WeatherIconId order");
+
+// Compressed icon for an OpenWeather code (e.g. "10d"), or NULL
+inline const PackedIcon *getWeatherIcon(const char *iconId)
+{
+    int id = weatherIconId(iconId);
+    return id == noWeatherIcon ? NULL : &weatherIcons[id];
+}
+
+#endif
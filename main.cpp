@@ -1,29 +1,34 @@
+#include "Maze.h"
+#include "MazeLevels.h"
+#include "Renderer.h"
+#include "SpriteCache.h"
+#include "SensorTask.h"
+#include "FrameScheduler.h"
+#include "TempTrend.h"
+#include "MazeGenerator.h"
+#include "MazeSolver.h"
+#include "HintField.h"
+#include "TileAtlas.h"
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ARDUINO
 #include <M5Core2.h>
-#include <Adafruit_VCNL4040.h> // Sensor libraries
-#include "Adafruit_SHT4x.h"    // Sensor libraries
-
-// Initialize library objects (sensors and Time protocols)
-Adafruit_VCNL4040 vcnl4040 = Adafruit_VCNL4040();
-Adafruit_SHT4x sht4 = Adafruit_SHT4x();
+#endif
 
 // LCD variables
 int sWidth;  // 320
 int sHeight; // 240
 
 // Time variables
-unsigned long lastTime = 0;
-unsigned long timerDelayMs;
+unsigned long timerDelayMs; // simulation step, set by the maze speed
+const unsigned long staticScreenWakeMs = 1000; // longest light sleep on static screens
+const unsigned long levelSettleMs = 300;       // hat level this long before the maze sleeps
 unsigned long mazeStartTime;
 unsigned long mazeEndTime;
 
-// state things
-enum ScreenState
-{
-    START,
-    INSTRUCTIONS,
-    MAZE,
-    END
-};
 static ScreenState screenState;
 
 // button things
@@ -38,6 +43,7 @@ const int buttonShiftX = 5;
 const uint32_t buttonSelectedColor = TFT_PINK;
 const uint32_t buttonUnselectedColor = TFT_LIGHTGREY;
 
+#ifdef ARDUINO
 Button easyButton(0, levelButtonY, medButtonX - easyButtonX, levelButtonHeight, "easy");
 Button medButton(medButtonX - buttonShiftX, levelButtonY, hardButtonX - medButtonX - buttonShiftX, levelButtonHeight, "med");
 Button hardButton(hardButtonX - buttonShiftX, levelButtonY, extremeButtonX - hardButtonX - buttonShiftX, levelButtonHeight, "hard");
@@ -45,66 +51,25 @@ Button extremeButton(extremeButtonX - buttonShiftX, levelButtonY, 320 - extremeB
 Button startButton(100, 190, 130, 50, "start");
 Button bottomRightButton(235, 210, 80, 30, "bottom-right");
 Button bottomLeftButton(0, 210, 160, 30, "bottom-left");
+#endif
 
 // maze things
-// floor types
-enum FloorType
-{
-    FLOWER,
-    ICE,
-    WALKABLE,
-    BLOOMED,
-    STARTTILE
-};
-
-// floor tile struct
-struct FloorTile
-{
-    int x;
-    int y;
-    // false means there is a wall, true means you can move to this position (no wall!)
-    bool left;
-    bool right;
-    bool above;
-    bool below;
-    FloorType floor;
-
-    FloorTile(int xCoor, int yCoor)
-    {
-        x = xCoor;
-        y = yCoor;
-        left = false;
-        right = false;
-        above = false;
-        below = false;
-        floor = WALKABLE;
-    }
-};
-
-// maze levels
-enum MazeLevel
-{
-    EASY,
-    MEDIUM,
-    HARD,
-    EXTREME
-};
 static MazeLevel mazeMap = EASY; // default to the easy map
 static MazeLevel mazeSpeed = EASY; // default easy speed
 
 // maze variables
-// maze size
-const int width = 8;
-const int height = 6;
-
-const int halfWall = 5;
-const int floorLength = 30;
-const int floorTileLength = 40;
+// maze size, up to maxMazeWidth x maxMazeHeight; the screen shows an 8x6
+// view of it that follows the hat
+const int maxMazeWidth = 64;
+const int maxMazeHeight = 64;
+int mazeWidth;
+int mazeHeight;
+const int viewMargin = 1; // tiles kept visible ahead of the hat
 
 const uint32_t floorColor = TFT_GREENYELLOW;
 const uint32_t wallColor = TFT_DARKGREEN;
 
-// maze array sample positions FloorType[height][width]
+// maze array, row major with mazeWidth tiles per row, sample positions
 /**
  * 00 01 02 03
  * 10 11 12 13
@@ -112,14 +77,12 @@ const uint32_t wallColor = TFT_DARKGREEN;
  * 30 31 32 33
  *
  */
-FloorTile mazeFloorPlan[height][width] = {
-    {FloorTile(0, 0), FloorTile(0, 1), FloorTile(0, 2), FloorTile(0, 3), FloorTile(0, 4), FloorTile(0, 5), FloorTile(0, 6), FloorTile(0, 7)},
-    {FloorTile(1, 0), FloorTile(1, 1), FloorTile(1, 2), FloorTile(1, 3), FloorTile(1, 4), FloorTile(1, 5), FloorTile(1, 6), FloorTile(1, 7)},
-    {FloorTile(2, 0), FloorTile(2, 1), FloorTile(2, 2), FloorTile(2, 3), FloorTile(2, 4), FloorTile(2, 5), FloorTile(2, 6), FloorTile(2, 7)},
-    {FloorTile(3, 0), FloorTile(3, 1), FloorTile(3, 2), FloorTile(3, 3), FloorTile(3, 4), FloorTile(3, 5), FloorTile(3, 6), FloorTile(3, 7)},
-    {FloorTile(4, 0), FloorTile(4, 1), FloorTile(4, 2), FloorTile(4, 3), FloorTile(4, 4), FloorTile(4, 5), FloorTile(4, 6), FloorTile(4, 7)},
-    {FloorTile(5, 0), FloorTile(5, 1), FloorTile(5, 2), FloorTile(5, 3), FloorTile(5, 4), FloorTile(5, 5), FloorTile(5, 6), FloorTile(5, 7)},
-};
+FloorTile mazeFloorPlan[maxMazeWidth * maxMazeHeight];
+
+inline FloorTile &tileAt(int col, int row)
+{
+    return mazeFloorPlan[row * mazeWidth + col];
+}
 
 int startX;
 int startY;
@@ -140,18 +103,61 @@ static Hat hat;
 
 // maze objective variables
 float iceMeltTemp;
+const float iceNearMeltC = 0.5; // closer than this to iceMeltTemp, read at high precision
+const unsigned long iceMaxReadGapMs = 2000; // longest wait between readings on an ice tile
+static TempTrend iceTrend;
+static unsigned long nextIceReadMs;
 const int bloomBrightness = 4000;
 int numFlowersToBloom;
 int numFlowersBloomed;
 
+// sensor reads run in the background, these are set while one is in flight
+static bool envRequested;
+static bool lightRequested;
+
+// set while the device is held level, since levelSinceMs
+static bool hatLevel;
+static unsigned long levelSinceMs;
+// a simulation step has looked at the tilt since the maze last napped
+static bool steppedSinceNap;
+
+// hint overlay, marks the way to the next flower (or the end) on the hat tile
+static bool hintsOn;
+const uint32_t hintColor = TFT_ORANGE;
+
+#ifdef ARDUINO
+// Touch events fire inside M5.update(), while Hal::update() holds the
+// internal bus. They are only queued there and handled right after, so a
+// screen redraw never keeps the sensor task off the IMU.
+struct PendingTouch
+{
+    EventHandler handler;
+    Event event;
+};
+static PendingTouch pendingTouches[4];
+static int pendingTouchCount = 0;
+#endif
+
 ////////////////////////////////////////////////////////////////////
 // Method header declarations
 ////////////////////////////////////////////////////////////////////
+#ifdef ARDUINO
 void onTap(Event &e);
 void onDoubleTap(Event &e);
+void queueTouch(EventHandler handler, Event &e);
+void queueTap(Event &e);
+void queueDoubleTap(Event &e);
+void handleTouches();
+#endif
 void initMazeVariables();
-void makeMazeMap();
+void loadMaze();
+bool checkMaze();
 void drawMaze();
+void drawView();
+void drawRows(int rowStart, int rowEnd);
+void followHat();
+int clampView(int start, int mazeSize, int viewSize);
+bool atlasCoversView();
 void drawStartScreen();
 void drawLevelButtons();
 void drawEndScreen();
@@ -160,47 +166,47 @@ void drawFlowerBud(int xCenter, int yCenter, uint32_t color);
 void drawIceBlock(int xCenter, int yCenter);
 void drawHowToPlayScreen();
 void drawHat(int xCenter, int yCenter);
-int convertCoor(int coor);
-void drawTileCover();
+void drawHint(int col, int row);
+void renderFlower(HalDisplay &gfx, int xCenter, int yCenter, uint32_t petalColor, uint32_t centerColor);
+void renderFlowerBud(HalDisplay &gfx, int xCenter, int yCenter, uint32_t color, uint32_t unused);
+void renderIceBlock(HalDisplay &gfx, int xCenter, int yCenter, uint32_t unused1, uint32_t unused2);
+void renderHat(HalDisplay &gfx, int xCenter, int yCenter, uint32_t unused1, uint32_t unused2);
+void renderTile(HalDisplay &gfx, uint8_t openings, uint8_t look);
+int tileCenterX(int col);
+int tileCenterY(int row);
+void drawTile(int col, int row);
+void moveHat(int dx, int dy);
 void drawEndTile();
 void drawStartTile();
+void drawEndLabel();
+void drawStartLabel();
 void drawSensorScreen();
+const char *levelName(MazeLevel level);
 
 void setup()
 {
-    // Initialize the device
-    M5.begin();
-    M5.IMU.Init();
-    M5.Buttons.addHandler(onTap, E_TOUCH);
-    bottomRightButton.addHandler(onDoubleTap, E_DBLTAP);
-    M5.Spk.begin();
-
-    // Initialize VCNL4040
-    if (!vcnl4040.begin())
-    {
-        Serial.println("Couldn't find VCNL4040 chip");
-        while (1)
-            delay(1);
-    }
-    Serial.println("Found VCNL4040 chip");
-
-    // Initialize SHT40
-    if (!sht4.begin())
-    {
-        Serial.println("Couldn't find SHT4x");
-        while (1)
-            delay(1);
-    }
-    Serial.println("Found SHT4x sensor");
-
-    sht4.setPrecision(SHT4X_HIGH_PRECISION);
-    sht4.setHeater(SHT4X_NO_HEATER);
+    // Initialize the device (display, IMU, sensors, speaker)
+    Hal::begin();
+    SensorTask::begin();
+#ifdef ARDUINO
+    M5.Buttons.addHandler(queueTap, E_TOUCH);
+    bottomRightButton.addHandler(queueDoubleTap, E_DBLTAP);
+#endif
 
     // Set up some variables for use in drawing
-    sWidth = M5.Lcd.width();
-    sHeight = M5.Lcd.height();
+    sWidth = Hal::lcd->width();
+    sHeight = Hal::lcd->height();
+    Renderer::beginView(sWidth, sHeight);
+
+    // Render the maze glyphs once up front so maze entry is all blits
+    SpriteCache::prepare(renderFlowerBud, TFT_WHITE);
+    SpriteCache::prepare(renderFlower, TFT_MAGENTA, TFT_YELLOW);
+    SpriteCache::prepare(renderIceBlock);
+    SpriteCache::prepare(renderHat);
+    TileAtlas::begin(renderTile);
 
     screenState = START;
+    FrameScheduler::start(FrameScheduler::defaultRenderPeriodMs);
 
     drawStartScreen();
 
@@ -220,171 +226,212 @@ void setup()
 
 void loop()
 {
-    M5.update();
+    // static screens idle at a low clock, the maze gets full speed while it works
+    Hal::setPowerProfile(screenState == MAZE ? POWER_INTERACTIVE : POWER_STATIC);
+    Hal::holdFullSpeed(screenState == MAZE);
+
+    Hal::update();
+#ifdef ARDUINO
+    handleTouches();
+#endif
+    SensorTask::update();
 
     if (screenState == MAZE)
     {
-        if (((millis() - lastTime) > timerDelayMs))
+        //~ ~ ~ ~ ~ ~ ~ ~ ~ ~ flower blooms ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
+        // checked every loop, not every step: the light sensor flags the
+        // bloom brightness itself and the sample lands as soon as it does
+        if (tileFloor(tileAt(currentX, currentY)) == FLOWER)
         {
-            //~ ~ ~ ~ ~ ~ ~ ~ ~ ~ check for ice tile ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
-            if (mazeFloorPlan[currentY][currentX].floor == ICE)
+            LightSample light;
+            if (!lightRequested)
             {
-                sensors_event_t rHum, temp;
-                sht4.getEvent(&rHum, &temp);
+                SensorTask::watchLight(bloomBrightness);
+                lightRequested = true;
+            }
+            else if (SensorTask::takeLight(&light) && light.whiteLight >= bloomBrightness)
+            {
+                lightRequested = false;
+                tileAt(currentX, currentY) = withFloor(tileAt(currentX, currentY), BLOOMED);
+                numFlowersBloomed++;
+                HintField::bloom(currentX, currentY);
+                Hal::spk->dingDong();
+                if (hintsOn)
+                    Renderer::markDirty(currentX, currentY);
+
+                if (numFlowersBloomed == numFlowersToBloom)
+                {
+                    // the end tile shows up once every flower has bloomed
+                    Renderer::markDirty(endX, endY);
+                }
+            }
+        }
 
-                if (iceMeltTemp == 0)
+        if (FrameScheduler::simStepDue())
+        {
+            steppedSinceNap = true;
+
+            //~ ~ ~ ~ ~ ~ ~ ~ ~ ~ check for ice tile ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
+            if (tileFloor(tileAt(currentX, currentY)) == ICE)
+            {
+                EnvSample env;
+                if (!envRequested)
+                {
+                    // the first reading sets the melting point, later ones are
+                    // spaced out by the trend until the crossing gets close
+                    if (iceMeltTemp == 0 || (long)(millis() - nextIceReadMs) >= 0)
+                    {
+                        // far from the melt point a quick, coarse reading is plenty
+                        bool nearMelt = iceMeltTemp == 0 || iceMeltTemp - iceTrend.level() <= iceNearMeltC;
+                        SensorTask::requestEnv(nearMelt ? ENV_HIGH_PRECISION : ENV_LOW_PRECISION);
+                        envRequested = true;
+                    }
+                }
+                else if (!SensorTask::takeEnv(&env))
+                {
+                    // still converting
+                }
+                else if (iceMeltTemp == 0)
                 {
                     // takes the current temp, adds 2 degrees C for the melting temperature
-                    iceMeltTemp = temp.temperature + 2.0;
+                    iceMeltTemp = env.temperature + 2.0;
+                    iceTrend.reset();
+                    iceTrend.update(env.temperature, env.timeMs);
+                    nextIceReadMs = millis();
+                    envRequested = false;
                 }
-                else if (temp.temperature >= iceMeltTemp)
+                else
                 {
-                    M5.Spk.DingDong();
-                    drawTileCover();
-                    drawHat(convertCoor(currentX), convertCoor(currentY));
-                    // melt the ice!
-                    mazeFloorPlan[currentY][currentX].floor = WALKABLE;
-                    // reset the iceMeltTemp to frozen for the next ice tile
-                    iceMeltTemp = 0;
+                    // the smoothed trend decides, so one noisy reading can't melt the ice
+                    iceTrend.update(env.temperature, env.timeMs);
+                    envRequested = false;
+                    if (iceTrend.reached(iceMeltTemp))
+                    {
+                        Hal::spk->dingDong();
+                        // melt the ice!
+                        tileAt(currentX, currentY) = withFloor(tileAt(currentX, currentY), WALKABLE);
+                        Renderer::markDirty(currentX, currentY);
+                        // reset the iceMeltTemp to frozen for the next ice tile
+                        iceMeltTemp = 0;
+                    }
+                    else
+                        // not warm enough yet, come back around the predicted crossing
+                        nextIceReadMs = millis() + iceTrend.readDelayMs(iceMeltTemp, timerDelayMs, iceMaxReadGapMs);
                 }
             }
             else
                 //~ ~ ~ ~ ~ ~ ~ ~ ~ ~ check for flower tile ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
-                if (mazeFloorPlan[currentY][currentX].floor == FLOWER)
+                if (tileFloor(tileAt(currentX, currentY)) == FLOWER)
                 {
-                    uint16_t whiteLight = vcnl4040.getWhiteLight();
-
-                    if (whiteLight >= bloomBrightness)
-                    {
-                        mazeFloorPlan[currentY][currentX].floor = BLOOMED;
-                        numFlowersBloomed++;
-                        M5.Spk.DingDong();
-
-                        if (numFlowersBloomed == numFlowersToBloom)
-                        {
-                            drawEndTile();
-                        }
-                    }
+                    // the hat stays put until the flower blooms (checked every loop above)
                 }
                 else
                     //~ ~ ~ ~ ~ ~ ~ ~ ~ ~ check for tilting movement ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
-                    if (mazeFloorPlan[currentY][currentX].floor == WALKABLE ||
-                        mazeFloorPlan[currentY][currentX].floor == BLOOMED ||
-                        mazeFloorPlan[currentY][currentX].floor == STARTTILE)
+                    if (tileFloor(tileAt(currentX, currentY)) == WALKABLE ||
+                        tileFloor(tileAt(currentX, currentY)) == BLOOMED ||
+                        tileFloor(tileAt(currentX, currentY)) == STARTTILE)
                     {
-                        float accX; // postive val: tilt to the left    negative val: tilt to the right
-                        float accY; // positive val: tilt down          negative val: tilt up
-                        float accZ; // don't need this data
-                        M5.IMU.getAccelData(&accX, &accY, &accZ);
-                        accX *= 9.8;
-                        accY *= 9.8;
-
-                        // figure out which way the device is tilting the most
-                        if (abs(accX) > 1 || abs(accY) > 1)
-                        { // only if it's tilted at least a little
-                            if (abs(accX) > abs(accY))
+                        // filtered direction from the sensor task, level until the first one
+                        TiltSample tilt = {};
+                        SensorTask::latestTilt(&tilt);
+                        if (tilt.direction != TILT_NONE)
+                            hatLevel = false;
+                        else if (!hatLevel)
+                        {
+                            hatLevel = true;
+                            levelSinceMs = millis();
+                        }
+
+                        // only if it's tilted at least a little, along the axis it tilts the most
+                        if (tilt.direction == TILT_LEFT)
+                        {
+                            if (tileAt(currentX, currentY) & OPEN_LEFT)
+                            {
+                                // move the hat to the left
+                                moveHat(-1, 0);
+                            }
+                        }
+                        else if (tilt.direction == TILT_RIGHT)
+                        {
+                            if (tileAt(currentX, currentY) & OPEN_RIGHT)
                             {
-                                // tilt left/right
-                                if (accX > 0)
-                                {
-                                    // tilt left
-                                    if (mazeFloorPlan[currentY][currentX].left)
-                                    {
-                                        // draw tile over current hat position
-                                        drawTileCover();
-
-                                        // move the hat to the left
-                                        hat.x = hat.x - 1;
-                                        // update the current tile
-                                        currentX -= 1;
-
-                                        // draw the hat in its new position
-                                        drawHat(convertCoor(hat.x), convertCoor(hat.y));
-                                    }
-                                }
-                                else
-                                {
-                                    // tilt right
-                                    if (mazeFloorPlan[currentY][currentX].right)
-                                    {
-                                        // draw tile over current hat position
-                                        drawTileCover();
-
-                                        // move the hat to the right
-                                        hat.x = hat.x + 1;
-                                        // update the current tile
-                                        currentX += 1;
-
-                                        // draw the hat in its new position
-                                        drawHat(convertCoor(hat.x), convertCoor(hat.y));
-                                    }
-                                }
+                                // move the hat to the right
+                                moveHat(1, 0);
                             }
-                            else
+                        }
+                        else if (tilt.direction == TILT_DOWN)
+                        {
+                            if (tileAt(currentX, currentY) & OPEN_BELOW)
+                            {
+                                // move the hat down
+                                moveHat(0, 1);
+                            }
+                        }
+                        else if (tilt.direction == TILT_UP)
+                        {
+                            if (tileAt(currentX, currentY) & OPEN_ABOVE)
                             {
-                                // tilt up/down
-                                if (accY > 0)
-                                {
-                                    // tilt down
-                                    if (mazeFloorPlan[currentY][currentX].below)
-                                    {
-                                        // draw tile over current hat position
-                                        drawTileCover();
-
-                                        // move the hat down
-                                        hat.y = hat.y + 1;
-                                        // update the current tile
-                                        currentY += 1;
-
-                                        // draw the hat in its new position
-                                        drawHat(convertCoor(hat.x), convertCoor(hat.y));
-                                    }
-                                }
-                                else
-                                {
-                                    // tilt up
-                                    if (mazeFloorPlan[currentY][currentX].above)
-                                    {
-                                        // draw tile over current hat position
-                                        drawTileCover();
-
-                                        // move the hat up
-                                        hat.y = hat.y - 1;
-                                        // update the current tile
-                                        currentY -= 1;
-
-                                        // draw the hat in its new position
-                                        drawHat(convertCoor(hat.x), convertCoor(hat.y));
-                                    }
-                                }
+                                // move the hat up
+                                moveHat(0, -1);
                             }
                         }
-                        // Delay: Update the last time to NOW
-                        lastTime = millis();
                     }
         }
 
+        // repaint whatever changed this tick
+        Renderer::flush(drawTile);
+
         if (currentX == endX && currentY == endY && numFlowersBloomed >= numFlowersToBloom)
         {
             mazeEndTime = millis();
             screenState = END;
             drawEndScreen();
+#ifdef ARDUINO
+            // the host bench prints these itself
+            unsigned long levelMs = mazeEndTime - mazeStartTime;
+            Serial.printf("level %s: %lu step overruns, %lu frame overruns, %lu of %lu ms idle\n",
+                          levelName(mazeMap), FrameScheduler::simOverruns, FrameScheduler::frameOverruns,
+                          FrameScheduler::idleMs, levelMs);
+#endif
         }
     }
+
+    // send the finished frame to the panel (framebuffer mode only)
+    Hal::present();
+
+    // static screens light-sleep until touched, a resting maze through its
+    // next step unless jolted, otherwise sleep until the next simulation
+    // step or render slot
+    Hal::holdFullSpeed(false);
+    unsigned long sleepStartMs = millis();
+    bool slept;
+    if (screenState == MAZE)
+    {
+        FloorType floor = tileFloor(tileAt(currentX, currentY));
+        // only the step can notice a tilt (and clear hatLevel), so every
+        // nap is followed by one before the maze may nap again
+        bool resting = hatLevel && steppedSinceNap && millis() - levelSinceMs >= levelSettleMs &&
+                       !Renderer::hasDamage() && (floor == WALKABLE || floor == BLOOMED || floor == STARTTILE);
+        // one simulation step at most: a slow tilt only shows up once awake
+        slept = resting && Hal::sleepUntilMotion(timerDelayMs);
+        if (slept)
+            steppedSinceNap = false;
+    }
+    else
+        slept = Hal::sleepUntilTouch(staticScreenWakeMs);
+
+    if (slept)
+        // give the sensor task one batch to catch up before the next step
+        FrameScheduler::resume(millis() - sleepStartMs, SensorTask::imuBatchMs);
+    else
+        FrameScheduler::waitForNextFrame();
 }
 
 void initMazeVariables()
 {
-    // set up the maze walls
-    makeMazeMap();
-
-    // Set up the starting and ending tiles of the maze
-    startX = 3;
-    startY = 0;
-    mazeFloorPlan[startY][startX].floor = STARTTILE;
-
-    endX = 4;
-    endY = 5;
+    // set up the maze walls, floor tiles, start and end
+    loadMaze();
+    HintField::build(mazeFloorPlan, mazeWidth, mazeHeight, endX, endY);
 
     // Set up the hat at the starting point
     hat.x = startX;
@@ -392,7 +439,12 @@ void initMazeVariables()
 
     // set the current x and y values at the starting point
     currentX = startX;
-    currentY = currentY;
+    currentY = startY;
+    envRequested = false;
+    lightRequested = false;
+    SensorTask::stopWatchingLight();
+    hatLevel = false;
+    steppedSinceNap = true;
 
     // set the maze speed
     switch (mazeSpeed)
@@ -414,829 +466,305 @@ void initMazeVariables()
         break;
     }
 
-    // set the number of flowers to bloom 
-    switch (mazeMap)
-    {
-    case EASY:
-        numFlowersToBloom = 5;
-        break;
-    case MEDIUM:
-        numFlowersToBloom = 6; 
-        break;
-    case HARD:
-        numFlowersToBloom = 5; // TODO update
-        break;
-    case EXTREME:
-        numFlowersToBloom = 5;
-        break;
-    default:
-        numFlowersToBloom = 5;
-        break;
-    }
-
     // set maze objective variables to default
     iceMeltTemp = 0;
     numFlowersBloomed = 0;
+    FrameScheduler::start(timerDelayMs);
     mazeStartTime = millis(); // set the timer to now!
     mazeEndTime = 0;
 }
 
-void makeMazeMap()
+#if MAZE_PROCEDURAL
+// Generated stand-ins for the hand-made levels, indexed by MazeLevel
+struct ProceduralLevel
 {
-    if (mazeMap == EASY) {
-        // row 1
-        mazeFloorPlan[0][0].right = true;
-
-        mazeFloorPlan[0][1].left = true;
-        mazeFloorPlan[0][1].right = true;
-        mazeFloorPlan[0][1].below = true;
-
-        mazeFloorPlan[0][2].left = true;
-        mazeFloorPlan[0][2].below = true;
-
-        mazeFloorPlan[0][3].below = true;
-
-        mazeFloorPlan[0][4].right = true;
-        mazeFloorPlan[0][4].below = true;
-
-        mazeFloorPlan[0][5].left = true;
-        mazeFloorPlan[0][5].right = true;
-
-        mazeFloorPlan[0][6].left = true;
-        mazeFloorPlan[0][6].below = true;
-
-        mazeFloorPlan[0][7].below = true;
-
-        // row 2
-        mazeFloorPlan[1][0].right = true;
-        mazeFloorPlan[1][0].below = true;
-
-        mazeFloorPlan[1][1].above = true;
-        mazeFloorPlan[1][1].left = true;
-
-        mazeFloorPlan[1][2].above = true;
-        mazeFloorPlan[1][2].below = true;
-
-        mazeFloorPlan[1][3].above = true;
-        mazeFloorPlan[1][3].below = true;
-
-        mazeFloorPlan[1][4].above = true;
-        mazeFloorPlan[1][4].right = true;
-
-        mazeFloorPlan[1][5].left = true;
-        mazeFloorPlan[1][5].below = true;
-
-        mazeFloorPlan[1][6].above = true;
-        mazeFloorPlan[1][6].below = true;
-
-        mazeFloorPlan[1][7].above = true;
-        mazeFloorPlan[1][7].below = true;
-
-        // row 3
-        mazeFloorPlan[2][0].above = true;
-        mazeFloorPlan[2][0].right = true;
-
-        mazeFloorPlan[2][1].left = true;
-        mazeFloorPlan[2][1].below = true;
-
-        mazeFloorPlan[2][2].above = true;
-        mazeFloorPlan[2][2].below = true;
-
-        mazeFloorPlan[2][3].above = true;
-        mazeFloorPlan[2][3].right = true;
-
-        mazeFloorPlan[2][4].left = true;
-        mazeFloorPlan[2][4].right = true;
-
-        mazeFloorPlan[2][5].left = true;
-        mazeFloorPlan[2][5].above = true;
-
-        mazeFloorPlan[2][6].above = true;
-        mazeFloorPlan[2][6].right = true;
-        mazeFloorPlan[2][6].below = true;
-
-        mazeFloorPlan[2][7].left = true;
-        mazeFloorPlan[2][7].above = true;
-
-        // row 4
-        mazeFloorPlan[3][0].below = true;
-
-        mazeFloorPlan[3][1].above = true;
-        mazeFloorPlan[3][1].below = true;
-
-        mazeFloorPlan[3][2].above = true;
-        mazeFloorPlan[3][2].right = true;
-
-        mazeFloorPlan[3][3].left = true;
-        mazeFloorPlan[3][3].right = true;
-
-        mazeFloorPlan[3][4].left = true;
-        mazeFloorPlan[3][4].right = true;
-
-        mazeFloorPlan[3][5].left = true;
-        mazeFloorPlan[3][5].right = true;
-        mazeFloorPlan[3][5].below = true;
-
-        mazeFloorPlan[3][6].left = true;
-        mazeFloorPlan[3][6].right = true;
-        mazeFloorPlan[3][6].above = true;
-
-        mazeFloorPlan[3][7].left = true;
-
-        // row 5
-        mazeFloorPlan[4][0].above = true;
-        mazeFloorPlan[4][0].below = true;
-
-        mazeFloorPlan[4][1].above = true;
-        mazeFloorPlan[4][1].below = true;
-        mazeFloorPlan[4][1].right = true;
-
-        mazeFloorPlan[4][2].left = true;
-        mazeFloorPlan[4][2].below = true;
-
-        mazeFloorPlan[4][3].right = true;
-
-        mazeFloorPlan[4][4].left = true;
-        mazeFloorPlan[4][4].below = true;
-
-        mazeFloorPlan[4][5].above = true;
-        mazeFloorPlan[4][5].below = true;
-
-        mazeFloorPlan[4][6].below = true;
-        mazeFloorPlan[4][6].right = true;
-
-        mazeFloorPlan[4][7].below = true;
-        mazeFloorPlan[4][7].left = true;
-
-        // row 6
-        mazeFloorPlan[5][0].above = true;
-        mazeFloorPlan[5][0].right = true;
-
-        mazeFloorPlan[5][1].left = true;
-        mazeFloorPlan[5][1].above = true;
-
-        mazeFloorPlan[5][2].right = true;
-        mazeFloorPlan[5][2].above = true;
-
-        mazeFloorPlan[5][3].left = true;
-        mazeFloorPlan[5][3].right = true;
-
-        mazeFloorPlan[5][4].left = true;
-        mazeFloorPlan[5][4].above = true;
-
-        mazeFloorPlan[5][5].above = true;
-        mazeFloorPlan[5][5].right = true;
-
-        mazeFloorPlan[5][6].left = true;
-        mazeFloorPlan[5][6].above = true;
-
-        mazeFloorPlan[5][7].above = true;
-
-        // FLOWERS
-        mazeFloorPlan[0][0].floor = FLOWER;
-        mazeFloorPlan[0][7].floor = FLOWER;
-        mazeFloorPlan[4][0].floor = FLOWER;
-        mazeFloorPlan[4][3].floor = FLOWER;
-        mazeFloorPlan[5][7].floor = FLOWER;
-
-        // ICE
-        mazeFloorPlan[0][4].floor = ICE;
-        mazeFloorPlan[5][5].floor = ICE;
-        mazeFloorPlan[3][1].floor = ICE;
-
-    } else if (mazeMap == MEDIUM) {
-        // row 1
-        mazeFloorPlan[0][0].right = true;
-        mazeFloorPlan[0][0].below = true;
-
-        mazeFloorPlan[0][1].below = true;
-        mazeFloorPlan[0][1].left = true;
-        mazeFloorPlan[0][1].right = true;
-
-        mazeFloorPlan[0][2].left = true;
-
-        mazeFloorPlan[0][3].below = true;
-
-        mazeFloorPlan[0][4].right = true;
-
-        mazeFloorPlan[0][5].right = true;
-        mazeFloorPlan[0][5].left = true;
-
-        mazeFloorPlan[0][6].right = true;
-        mazeFloorPlan[0][6].left = true;
-        mazeFloorPlan[0][6].below = true;
-
-        mazeFloorPlan[0][7].below = true;
-        mazeFloorPlan[0][7].left = true;
-
-        // row 2
-        mazeFloorPlan[1][0].above = true;
-        mazeFloorPlan[1][0].below = true;
-
-        mazeFloorPlan[1][1].above = true;
-        mazeFloorPlan[1][1].below = true;
-
-        mazeFloorPlan[1][2].below = true;
-        mazeFloorPlan[1][2].right = true;
-
-        mazeFloorPlan[1][3].above = true;
-        mazeFloorPlan[1][3].left = true;
-
-        mazeFloorPlan[1][4].right = true;
-        mazeFloorPlan[1][4].below = true;
-
-        mazeFloorPlan[1][5].below = true;
-        mazeFloorPlan[1][5].left = true;
-
-        mazeFloorPlan[1][6].above = true;
-
-        mazeFloorPlan[1][7].above = true;
-        mazeFloorPlan[1][7].below = true;
-
-        // row 3
-        mazeFloorPlan[2][0].below = true;
-        mazeFloorPlan[2][0].above = true;
-
-        mazeFloorPlan[2][1].above = true;
-        mazeFloorPlan[2][1].below = true;
-
-        mazeFloorPlan[2][2].above = true;
-        mazeFloorPlan[2][2].right = true;
-
-        mazeFloorPlan[2][3].right = true;
-        mazeFloorPlan[2][3].left = true;
-
-        mazeFloorPlan[2][4].left = true;
-        mazeFloorPlan[2][4].above = true;
-
-        mazeFloorPlan[2][5].above = true;
-        mazeFloorPlan[2][5].right = true;
-
-        mazeFloorPlan[2][6].right = true;
-        mazeFloorPlan[2][6].left = true;
-
-        mazeFloorPlan[2][7].left = true;
-        mazeFloorPlan[2][7].above = true;
-        mazeFloorPlan[2][7].below = true;
-
-        // row 4
-        mazeFloorPlan[3][0].above = true;
-        mazeFloorPlan[3][0].below = true;
-
-        mazeFloorPlan[3][1].above = true;
-
-        mazeFloorPlan[3][2].right = true;
-        mazeFloorPlan[3][2].below = true;
-
-        mazeFloorPlan[3][3].right = true;
-        mazeFloorPlan[3][3].left = true;
-
-        mazeFloorPlan[3][4].left = true;
-        mazeFloorPlan[3][4].right = true;
-
-        mazeFloorPlan[3][5].below = true;
-        mazeFloorPlan[3][5].left = true;
-        mazeFloorPlan[3][5].right = true;
-
-        mazeFloorPlan[3][6].left = true;
-        mazeFloorPlan[3][6].below = true;
-
-        mazeFloorPlan[3][7].below = true;
-        mazeFloorPlan[3][7].above = true;
-
-        // row 5
-        mazeFloorPlan[4][0].above = true;
-        mazeFloorPlan[4][0].below = true;
-
-        mazeFloorPlan[4][1].right = true;
-        mazeFloorPlan[4][1].below = true;
-
-        mazeFloorPlan[4][2].left = true;
-        mazeFloorPlan[4][2].above = true;
-
-        mazeFloorPlan[4][3].right = true;
-        mazeFloorPlan[4][3].below = true;
-
-        mazeFloorPlan[4][4].below = true;
-        mazeFloorPlan[4][4].left = true;
-
-        mazeFloorPlan[4][5].above = true;
-        mazeFloorPlan[4][5].below = true;
-
-        mazeFloorPlan[4][6].above = true;
-
-        mazeFloorPlan[4][7].above = true;
-        mazeFloorPlan[4][7].below = true;
-
-        // row 6
-        mazeFloorPlan[5][0].above = true;
-        mazeFloorPlan[5][0].right = true;
-
-        mazeFloorPlan[5][1].right = true;
-        mazeFloorPlan[5][1].left = true;
-        mazeFloorPlan[5][1].above = true;
-
-        mazeFloorPlan[5][2].left = true;
-        mazeFloorPlan[5][2].right = true;
-
-        mazeFloorPlan[5][3].left = true;
-        mazeFloorPlan[5][3].above = true;
-
-        mazeFloorPlan[5][4].above = true;
-
-        mazeFloorPlan[5][5].above = true;
-        mazeFloorPlan[5][5].right = true;
-
-        mazeFloorPlan[5][6].left = true;
-        mazeFloorPlan[5][6].right = true;
-
-        mazeFloorPlan[5][7].left = true;
-        mazeFloorPlan[5][7].above = true;
-
-        // FLOWERS
-        mazeFloorPlan[0][2].floor = FLOWER;
-        mazeFloorPlan[0][4].floor = FLOWER;
-        mazeFloorPlan[1][6].floor = FLOWER;
-        mazeFloorPlan[3][1].floor = FLOWER;
-        mazeFloorPlan[4][2].floor = FLOWER;
-        mazeFloorPlan[4][6].floor = FLOWER;
-
-        // ICE
-        mazeFloorPlan[2][2].floor = ICE;
-        mazeFloorPlan[4][7].floor = ICE;
-        mazeFloorPlan[4][0].floor = ICE;
-        mazeFloorPlan[1][1].floor = ICE;
-
-    } else if (mazeMap == HARD) {
-        // row 1
-        mazeFloorPlan[0][0].right = true;
-        mazeFloorPlan[0][0].below = true;
-
-        mazeFloorPlan[0][1].below = true;
-        mazeFloorPlan[0][1].left = true;
-
-        mazeFloorPlan[0][2].right = true;
-
-        mazeFloorPlan[0][3].below = true;
-        mazeFloorPlan[0][3].left = true;
-
-        mazeFloorPlan[0][4].right = true;
-        mazeFloorPlan[0][4].below = true;
-
-        mazeFloorPlan[0][5].right = true;
-        mazeFloorPlan[0][5].left = true;
-
-        mazeFloorPlan[0][6].right = true;
-        mazeFloorPlan[0][6].left = true;
-
-        mazeFloorPlan[0][7].below = true;
-        mazeFloorPlan[0][7].left = true;
-
-        // row 2
-        mazeFloorPlan[1][0].above = true;
-        mazeFloorPlan[1][0].below = true;
-
-        mazeFloorPlan[1][1].above = true;
-        mazeFloorPlan[1][1].below = true;
-
-        mazeFloorPlan[1][2].below = true;
-        mazeFloorPlan[1][2].right = true;
-
-        mazeFloorPlan[1][3].above = true;
-        mazeFloorPlan[1][3].left = true;
-
-        mazeFloorPlan[1][4].right = true;
-        mazeFloorPlan[1][4].above = true;
-
-        mazeFloorPlan[1][5].below = true;
-        mazeFloorPlan[1][5].left = true;
-
-        mazeFloorPlan[1][6].right = true;
-
-        mazeFloorPlan[1][7].above = true;
-        mazeFloorPlan[1][7].left = true;
-
-        // row 3
-        mazeFloorPlan[2][0].below = true;
-        mazeFloorPlan[2][0].above = true;
-
-        mazeFloorPlan[2][1].above = true;
-        mazeFloorPlan[2][1].right = true;
-
-        mazeFloorPlan[2][2].above = true;
-        mazeFloorPlan[2][2].left = true;
-
-        mazeFloorPlan[2][3].right = true;
-        mazeFloorPlan[2][3].below = true;
-
-        mazeFloorPlan[2][4].left = true;
-        mazeFloorPlan[2][4].right = true;
-
-        mazeFloorPlan[2][5].above = true;
-        mazeFloorPlan[2][5].left = true;
-        mazeFloorPlan[2][5].below = true;
-
-        mazeFloorPlan[2][6].right = true;
-        mazeFloorPlan[2][6].below = true;
-
-        mazeFloorPlan[2][7].left = true;
-        mazeFloorPlan[2][7].below = true;
-
-        // row 4
-        mazeFloorPlan[3][0].above = true;
-        mazeFloorPlan[3][0].below = true;
-
-        mazeFloorPlan[3][1].right = true;
-
-        mazeFloorPlan[3][2].right = true;
-        mazeFloorPlan[3][2].left = true;
-
-        mazeFloorPlan[3][3].above = true;
-        mazeFloorPlan[3][3].left = true;
-
-        mazeFloorPlan[3][4].below = true;
-        mazeFloorPlan[3][4].right = true;
-
-        mazeFloorPlan[3][5].above = true;
-        mazeFloorPlan[3][5].left = true;
-
-        mazeFloorPlan[3][6].above = true;
-        mazeFloorPlan[3][6].below = true;
-
-        mazeFloorPlan[3][7].below = true;
-        mazeFloorPlan[3][7].above = true;
-
-        // row 5
-        mazeFloorPlan[4][0].above = true;
-        mazeFloorPlan[4][0].below = true;
-        mazeFloorPlan[4][0].right = true;
-
-        mazeFloorPlan[4][1].left = true;
-        mazeFloorPlan[4][1].below = true;
-
-        mazeFloorPlan[4][2].right = true;
-        mazeFloorPlan[4][2].below = true;
-
-        mazeFloorPlan[4][3].left = true;
-        mazeFloorPlan[4][3].below = true;
-
-        mazeFloorPlan[4][4].above = true;
-        mazeFloorPlan[4][4].right = true;
-
-        mazeFloorPlan[4][5].left = true;
-        mazeFloorPlan[4][5].right = true;
-
-        mazeFloorPlan[4][6].left = true;
-        mazeFloorPlan[4][6].above = true;
-
-        mazeFloorPlan[4][7].above = true;
-        mazeFloorPlan[4][7].below = true;
-
-        // row 6
-        mazeFloorPlan[5][0].above = true;
-
-        mazeFloorPlan[5][1].right = true;
-        mazeFloorPlan[5][1].above = true;
-
-        mazeFloorPlan[5][2].left = true;
-        mazeFloorPlan[5][2].above = true;
-
-        mazeFloorPlan[5][3].right = true;
-        mazeFloorPlan[5][3].above = true;
-
-        mazeFloorPlan[5][4].left = true;
-        mazeFloorPlan[5][4].right = true;
-
-        mazeFloorPlan[5][5].left = true;
-        mazeFloorPlan[5][5].right = true;
-
-        mazeFloorPlan[5][6].left = true;
-        mazeFloorPlan[5][6].right = true;
-
-        mazeFloorPlan[5][7].left = true;
-        mazeFloorPlan[5][7].above = true;
-
-        // FLOWERS
-        mazeFloorPlan[0][2].floor = FLOWER;
-        mazeFloorPlan[1][6].floor = FLOWER;
-        mazeFloorPlan[3][1].floor = FLOWER;
-        mazeFloorPlan[4][6].floor = FLOWER;
-        mazeFloorPlan[5][0].floor = FLOWER;
-        mazeFloorPlan[5][7].floor = FLOWER;
-
-        // ICE
-        mazeFloorPlan[0][1].floor = ICE;
-        mazeFloorPlan[1][5].floor = ICE;
-        mazeFloorPlan[3][3].floor = ICE;
-        mazeFloorPlan[5][5].floor = ICE;
-        mazeFloorPlan[4][0].floor = ICE;
-
-    } else if (mazeMap == EXTREME) {
-         // row 1
-        mazeFloorPlan[0][0].below = true;
-
-        mazeFloorPlan[0][1].below = true;
-        mazeFloorPlan[0][1].right = true;
-
-        mazeFloorPlan[0][2].right = true;
-        mazeFloorPlan[0][2].left = true;
-        mazeFloorPlan[0][2].below = true;
-
-        mazeFloorPlan[0][3].left = true;
-
-        mazeFloorPlan[0][4].right = true;
-        mazeFloorPlan[0][4].below = true;
-
-        mazeFloorPlan[0][5].below = true;
-        mazeFloorPlan[0][5].left = true;
-
-        mazeFloorPlan[0][6].right = true;
-        mazeFloorPlan[0][6].below = true;
-
-        mazeFloorPlan[0][7].below = true;
-        mazeFloorPlan[0][7].left = true;
-
-        // row 2
-        mazeFloorPlan[1][0].above = true;
-        mazeFloorPlan[1][0].right = true;
-
-        mazeFloorPlan[1][1].above = true;
-        mazeFloorPlan[1][1].left = true;
-
-        mazeFloorPlan[1][2].above = true;
-        mazeFloorPlan[1][2].right = true;
-
-        mazeFloorPlan[1][3].below = true;
-        mazeFloorPlan[1][3].left = true;
-
-        mazeFloorPlan[1][4].below = true;
-        mazeFloorPlan[1][4].above = true;
-
-        mazeFloorPlan[1][5].above = true;
-        mazeFloorPlan[1][5].right = true;
-
-        mazeFloorPlan[1][6].above = true;
-        mazeFloorPlan[1][6].left = true;
-        mazeFloorPlan[1][6].below = true;
-
-        mazeFloorPlan[1][7].above = true;
-
-        // row 3
-        mazeFloorPlan[2][0].below = true;
-        mazeFloorPlan[2][0].right = true;
-
-        mazeFloorPlan[2][1].below = true;
-        mazeFloorPlan[2][1].left = true;
-
-        mazeFloorPlan[2][2].below = true;
-
-        mazeFloorPlan[2][3].above = true;
-        mazeFloorPlan[2][3].below = true;
-
-        mazeFloorPlan[2][4].above = true;
-        mazeFloorPlan[2][4].right = true;
-
-        mazeFloorPlan[2][5].left = true;
-
-        mazeFloorPlan[2][6].right = true;
-        mazeFloorPlan[2][6].above = true;
-
-        mazeFloorPlan[2][7].left = true;
-        mazeFloorPlan[2][7].below = true;
-
-        // row 4
-        mazeFloorPlan[3][0].above = true;
-        mazeFloorPlan[3][0].below = true;
-
-        mazeFloorPlan[3][1].above = true;
-        mazeFloorPlan[3][1].below = true;
-
-        mazeFloorPlan[3][2].above = true;
-        mazeFloorPlan[3][2].below = true;
-
-        mazeFloorPlan[3][3].above = true;
-        mazeFloorPlan[3][3].right = true;
-
-        mazeFloorPlan[3][4].left = true;
-        mazeFloorPlan[3][4].right = true;
-
-        mazeFloorPlan[3][5].below = true;
-        mazeFloorPlan[3][5].left = true;
-
-        mazeFloorPlan[3][6].right = true;
-        mazeFloorPlan[3][6].below = true;
-
-        mazeFloorPlan[3][7].left = true;
-        mazeFloorPlan[3][7].above = true;
-
-        // row 5
-        mazeFloorPlan[4][0].above = true;
-        mazeFloorPlan[4][0].below = true;
-
-        mazeFloorPlan[4][1].above = true;
-        mazeFloorPlan[4][1].right = true;
-
-        mazeFloorPlan[4][2].above = true;
-        mazeFloorPlan[4][2].left = true;
-
-        mazeFloorPlan[4][3].below = true;
-
-        mazeFloorPlan[4][4].below = true;
-        mazeFloorPlan[4][4].right = true;
-
-        mazeFloorPlan[4][5].left = true;
-        mazeFloorPlan[4][5].above = true;
-
-        mazeFloorPlan[4][6].right = true;
-        mazeFloorPlan[4][6].above = true;
-
-        mazeFloorPlan[4][7].left = true;
-        mazeFloorPlan[4][7].below = true;
-
-        // row 6
-        mazeFloorPlan[5][0].above = true;
-        mazeFloorPlan[5][0].right = true;
+    uint8_t width;
+    uint8_t height;
+    MazeAlgorithm algorithm;
+    uint8_t flowers;
+    uint8_t ices;
+};
 
-        mazeFloorPlan[5][1].right = true;
-        mazeFloorPlan[5][1].left = true;
+const ProceduralLevel proceduralLevels[] = {
+    {8, 6, MAZE_BACKTRACKER, 5, 3},
+    {16, 12, MAZE_KRUSKAL, 6, 4},
+    {32, 24, MAZE_WILSON, 8, 8},
+    {64, 64, MAZE_WILSON, 10, 16},
+};
 
-        mazeFloorPlan[5][2].left = true;
-        mazeFloorPlan[5][2].right = true;
+const int maxMazeAttempts = 4;
+#endif
 
-        mazeFloorPlan[5][3].right = true;
-        mazeFloorPlan[5][3].above = true;
-        mazeFloorPlan[5][3].left = true;
+void loadMaze()
+{
+#if MAZE_PROCEDURAL
+    // a fresh maze every time, seeded from the clock; a maze that fails the
+    // check is thrown away and the next seed tried
+    const ProceduralLevel &procedural = proceduralLevels[mazeMap];
+    uint32_t seed = (uint32_t)millis() * 2654435761u + mazeMap;
+    for (int attempt = 0; attempt < maxMazeAttempts; attempt++, seed++)
+    {
+        MazeLayout layout;
+        mazeWidth = procedural.width;
+        mazeHeight = procedural.height;
+        if (!MazeGenerator::generate(mazeFloorPlan, mazeWidth, mazeHeight, seed, procedural.algorithm,
+                                     procedural.flowers, procedural.ices, &layout))
+            break;
+
+        startX = layout.startX;
+        startY = layout.startY;
+        endX = layout.endX;
+        endY = layout.endY;
+        numFlowersToBloom = layout.flowersToBloom;
+        if (checkMaze())
+            return;
+    }
+#endif
 
-        mazeFloorPlan[5][4].left = true;
-        mazeFloorPlan[5][4].right = true;
-        mazeFloorPlan[5][4].above = true;
+    // copy the packed level out of flash into the working floor plan
+    const MazeLevelView &level = mazeLevels[mazeMap];
 
-        mazeFloorPlan[5][5].left = true;
-        mazeFloorPlan[5][5].right = true;
+    mazeWidth = level.width;
+    mazeHeight = level.height;
+    memcpy(mazeFloorPlan, level.cells, mazeWidth * mazeHeight);
 
-        mazeFloorPlan[5][6].left = true;
-        mazeFloorPlan[5][6].right = true;
+    startX = level.startX;
+    startY = level.startY;
+    endX = level.endX;
+    endY = level.endY;
+    numFlowersToBloom = level.flowersToBloom;
+    checkMaze();
+}
 
-        mazeFloorPlan[5][7].left = true;
-        mazeFloorPlan[5][7].above = true;
+// Validates the loaded maze and finds its shortest route, logs what's wrong
+bool checkMaze()
+{
+    MazeProblem problem = MazeSolver::check(mazeFloorPlan, mazeWidth, mazeHeight, startX, startY, endX, endY,
+                                            numFlowersToBloom);
+    if (problem == MAZE_OK)
+        return true;
+
+#ifdef ARDUINO
+    Serial.printf("maze %s: %s at %d,%d\n", levelName(mazeMap), MazeSolver::describe(problem),
+                  MazeSolver::problemX(), MazeSolver::problemY());
+#else
+    fprintf(stderr, "maze %s: %s at %d,%d\n", levelName(mazeMap), MazeSolver::describe(problem),
+            MazeSolver::problemX(), MazeSolver::problemY());
+#endif
+    return false;
+}
 
-        // FLOWERS
-        mazeFloorPlan[0][0].floor = FLOWER;
-        mazeFloorPlan[1][7].floor = FLOWER;
-        mazeFloorPlan[2][2].floor = FLOWER;
-        mazeFloorPlan[2][5].floor = FLOWER;
-        mazeFloorPlan[4][3].floor = FLOWER;
-        mazeFloorPlan[5][7].floor = FLOWER;
-        mazeFloorPlan[5][0].floor = FLOWER;
+void drawMaze()
+{
+    // start with the hat in the middle of the view
+    Renderer::setView(clampView(hat.x - Renderer::viewCols() / 2, mazeWidth, Renderer::viewCols()),
+                      clampView(hat.y - Renderer::viewRows() / 2, mazeHeight, Renderer::viewRows()));
+    drawView();
+    Renderer::clearDamage();
+}
 
-        // ICE
-        mazeFloorPlan[0][5].floor = ICE;
-        mazeFloorPlan[1][1].floor = ICE;
-        mazeFloorPlan[1][6].floor = ICE;
-        mazeFloorPlan[2][1].floor = ICE;
-        mazeFloorPlan[5][3].floor = ICE;
-        mazeFloorPlan[3][3].floor = ICE;
-        
+void drawView()
+{
+    Hal::scrollVertically(Renderer::scrollLines());
+    Hal::lcd->startWrite();
+    if (!atlasCoversView())
+        Hal::lcd->clear(floorColor);
+
+    // the view's rows wrap around the bottom of the panel at most once
+    int top = Renderer::viewRow();
+    int bottom = top + Renderer::viewRows();
+    if (bottom > mazeHeight)
+        bottom = mazeHeight;
+    int wrap = top + Renderer::viewRows() - top % Renderer::viewRows();
+    if (wrap < bottom)
+    {
+        drawRows(top, wrap);
+        drawRows(wrap, bottom);
     }
+    else
+        drawRows(top, bottom);
 
+    Hal::lcd->endWrite();
 }
 
-void drawMaze()
+// Rows [rowStart, rowEnd) of the view, they have to sit in one band of the panel
+void drawRows(int rowStart, int rowEnd)
 {
-    M5.Lcd.clear(floorColor);
+    int colStart = Renderer::viewCol();
+    int colEnd = colStart + Renderer::viewCols();
+    if (colEnd > mazeWidth)
+        colEnd = mazeWidth;
 
-    for (int row = 0; row < height; row++)
+    // atlas tiles carry their own walls and floor, every tile is one blit
+    if (TileAtlas::ready())
     {
-        for (int col = 0; col < width; col++)
-        {
-
-            // draw walls, if there are any
-            if (!mazeFloorPlan[row][col].left)
-            {
-                M5.Lcd.fillRect(col * floorTileLength, row * floorTileLength, halfWall, floorTileLength, wallColor);
-            }
-            if (!mazeFloorPlan[row][col].above)
-            {
-                M5.Lcd.fillRect(col * floorTileLength, row * floorTileLength, floorTileLength, halfWall, wallColor);
-            }
-            if (!mazeFloorPlan[row][col].right)
-            {
-                M5.Lcd.fillRect((col * floorTileLength) + halfWall + floorLength, row * floorTileLength, halfWall, floorTileLength, wallColor);
-            }
-            if (!mazeFloorPlan[row][col].below)
-            {
-                M5.Lcd.fillRect(col * floorTileLength, (row * floorTileLength) + halfWall + floorLength, floorTileLength, halfWall, wallColor);
-            }
-
-            // draw start tile, if applicable
-            if (mazeFloorPlan[row][col].floor == STARTTILE)
-            {
-                drawStartTile();
-            }
+        for (int row = rowStart; row < rowEnd; row++)
+            for (int col = colStart; col < colEnd; col++)
+                drawTile(col, row);
+        return;
+    }
 
-            // draw flower bud tiles, if applicable
-            if (mazeFloorPlan[row][col].floor == FLOWER)
-            {
-                drawFlowerBud(convertCoor(col), convertCoor(row), TFT_WHITE);
-            }
+    // draw walls as merged runs
+    Renderer::drawWalls(mazeFloorPlan, mazeWidth, colStart, colEnd, rowStart, rowEnd, Renderer::tileX(colStart),
+                        Renderer::tileY(rowStart), wallColor);
 
-            // draw ice tiles, if applicable
-            if (mazeFloorPlan[row][col].floor == ICE)
+    // draw start, flower bud and ice tiles, plus the hat
+    for (int row = rowStart; row < rowEnd; row++)
+    {
+        for (int col = colStart; col < colEnd; col++)
+        {
+            if (tileFloor(tileAt(col, row)) != WALKABLE || (col == hat.x && row == hat.y))
             {
-                drawIceBlock(convertCoor(col), convertCoor(row));
+                drawTile(col, row);
             }
         }
     }
 }
 
+// Keeps the hat inside the view. Up and down the panel scrolls a row at a
+// time and only the row coming into view is drawn; it can't scroll
+// sideways, so there the view jumps half a screen and is redrawn.
+void followHat()
+{
+    int col = Renderer::viewCol();
+    int row = Renderer::viewRow();
+    int cols = Renderer::viewCols();
+    int rows = Renderer::viewRows();
+
+    if (hat.y < row + viewMargin)
+        row = hat.y - viewMargin;
+    else if (hat.y >= row + rows - viewMargin)
+        row = hat.y - rows + 1 + viewMargin;
+    if (hat.x < col + viewMargin || hat.x >= col + cols - viewMargin)
+        col = hat.x - cols / 2;
+    col = clampView(col, mazeWidth, cols);
+    row = clampView(row, mazeHeight, rows);
+
+    if (col == Renderer::viewCol() && row == Renderer::viewRow())
+        return;
+
+    bool oneRow = col == Renderer::viewCol() && abs(row - Renderer::viewRow()) == 1;
+    int newRow = row > Renderer::viewRow() ? row + rows - 1 : row;
+    Renderer::setView(col, row);
+    if (!oneRow)
+    {
+        drawView();
+        return;
+    }
+
+    Hal::scrollVertically(Renderer::scrollLines());
+    Hal::lcd->startWrite();
+    if (!atlasCoversView())
+        Hal::lcd->fillRect(0, Renderer::tileY(newRow), sWidth, floorTileLength, floorColor);
+    drawRows(newRow, newRow + 1);
+    Hal::lcd->endWrite();
+}
+
+// True when atlas blits paint every pixel of the view, so nothing needs clearing first
+bool atlasCoversView()
+{
+    return TileAtlas::ready() && mazeWidth >= Renderer::viewCols() && mazeHeight >= Renderer::viewRows();
+}
+
+int clampView(int start, int mazeSize, int viewSize)
+{
+    if (start > mazeSize - viewSize)
+        start = mazeSize - viewSize;
+    if (start < 0)
+        start = 0;
+    return start;
+}
+
 void drawStartScreen()
 {
-    M5.Lcd.clear(TFT_BLACK);
+    Hal::lcd->clear(TFT_BLACK);
 
-    M5.Lcd.setCursor(sWidth / 5, sHeight / 3);
-    M5.Lcd.setTextColor(TFT_WHITE);
-    M5.Lcd.setTextSize(3);
-    M5.Lcd.println("Maze Time!");
+    Hal::lcd->setCursor(sWidth / 5, sHeight / 3);
+    Hal::lcd->setTextColor(TFT_WHITE);
+    Hal::lcd->setTextSize(3);
+    Hal::lcd->println("Maze Time!");
 
     drawFlower(sWidth/2, sHeight/2, TFT_MAGENTA, TFT_YELLOW);	
     drawFlower((sWidth/2)-25, sHeight/2, TFT_WHITE, TFT_YELLOW);	
     drawFlower((sWidth/2)+25, sHeight/2, TFT_WHITE, TFT_YELLOW);
 
-    M5.Lcd.setTextColor(TFT_PINK);
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.setCursor(20 + 10 + 100, 40 + 10 + 70 + 70 + 20);
-    M5.Lcd.print("start!");
+    Hal::lcd->setTextColor(TFT_PINK);
+    Hal::lcd->setTextSize(2);
+    Hal::lcd->setCursor(20 + 10 + 100, 40 + 10 + 70 + 70 + 20);
+    Hal::lcd->print("start!");
 
-    M5.Lcd.setCursor(240, 225);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextColor(TFT_MAGENTA);
-    M5.Lcd.print("how to play");
+    Hal::lcd->setCursor(240, 225);
+    Hal::lcd->setTextSize(1);
+    Hal::lcd->setTextColor(TFT_MAGENTA);
+    Hal::lcd->print("how to play");
 
     drawLevelButtons();
 }
 
 void drawLevelButtons()
 {
-    M5.Lcd.setTextSize(2);
+    Hal::lcd->setTextSize(2);
 
-    M5.Lcd.setTextColor(mazeSpeed == EASY ? buttonSelectedColor : buttonUnselectedColor);
-    M5.Lcd.setCursor(easyButtonX, textLevelButtonY);
-    M5.Lcd.print("Easy");
+    Hal::lcd->setTextColor(mazeSpeed == EASY ? buttonSelectedColor : buttonUnselectedColor);
+    Hal::lcd->setCursor(easyButtonX, textLevelButtonY);
+    Hal::lcd->print("Easy");
 
-    M5.Lcd.setTextColor(mazeSpeed == MEDIUM ? buttonSelectedColor : buttonUnselectedColor);
-    M5.Lcd.setCursor(medButtonX, textLevelButtonY);
-    M5.Lcd.print("Medium");
+    Hal::lcd->setTextColor(mazeSpeed == MEDIUM ? buttonSelectedColor : buttonUnselectedColor);
+    Hal::lcd->setCursor(medButtonX, textLevelButtonY);
+    Hal::lcd->print("Medium");
 
-    M5.Lcd.setTextColor(mazeSpeed == HARD ? buttonSelectedColor : buttonUnselectedColor);
-    M5.Lcd.setCursor(hardButtonX, textLevelButtonY);
-    M5.Lcd.print("Hard");
+    Hal::lcd->setTextColor(mazeSpeed == HARD ? buttonSelectedColor : buttonUnselectedColor);
+    Hal::lcd->setCursor(hardButtonX, textLevelButtonY);
+    Hal::lcd->print("Hard");
 
-    M5.Lcd.setTextColor(mazeSpeed == EXTREME ? buttonSelectedColor : buttonUnselectedColor);
-    M5.Lcd.setCursor(extremeButtonX, textLevelButtonY);
-    M5.Lcd.print("Extreme");
+    Hal::lcd->setTextColor(mazeSpeed == EXTREME ? buttonSelectedColor : buttonUnselectedColor);
+    Hal::lcd->setCursor(extremeButtonX, textLevelButtonY);
+    Hal::lcd->print("Extreme");
 }
 
 void drawHowToPlayScreen()
 {
-    M5.Lcd.clear(TFT_BLACK);
+    Hal::lcd->clear(TFT_BLACK);
 
-    M5.Lcd.setCursor(20, 20);
-    M5.Lcd.setTextColor(TFT_WHITE);
-    M5.Lcd.setTextSize(3);
-    M5.Lcd.print("how to play:");
+    Hal::lcd->setCursor(20, 20);
+    Hal::lcd->setTextColor(TFT_WHITE);
+    Hal::lcd->setTextSize(3);
+    Hal::lcd->print("how to play:");
 
     drawFlowerBud(20, 60, WHITE);
-    M5.Lcd.setCursor(40, 60);
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.print("navigate through the");
-    M5.Lcd.setCursor(40, 80);
-    M5.Lcd.print("maze!");
+    Hal::lcd->setCursor(40, 60);
+    Hal::lcd->setTextSize(2);
+    Hal::lcd->print("navigate through the");
+    Hal::lcd->setCursor(40, 80);
+    Hal::lcd->print("maze!");
 
     drawFlower(20, 120, PINK, YELLOW);
-    M5.Lcd.setCursor(40, 120);
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.print("shine a light on each ");
-    M5.Lcd.setCursor(40, 140);
-    M5.Lcd.print("flower bud to make");
-    M5.Lcd.setCursor(40, 160);
-    M5.Lcd.print("them bloom!");
+    Hal::lcd->setCursor(40, 120);
+    Hal::lcd->setTextSize(2);
+    Hal::lcd->print("shine a light on each ");
+    Hal::lcd->setCursor(40, 140);
+    Hal::lcd->print("flower bud to make");
+    Hal::lcd->setCursor(40, 160);
+    Hal::lcd->print("them bloom!");
 
     drawIceBlock(20, 200);
-    M5.Lcd.setCursor(40, 200);
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.print("melt ice blocks to keep ");
-    M5.Lcd.setCursor(40, 220);
-    M5.Lcd.print("moving!");
-
-    M5.Lcd.setCursor(230, 225);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextColor(TFT_MAGENTA);
-    M5.Lcd.print("back to start");
+    Hal::lcd->setCursor(40, 200);
+    Hal::lcd->setTextSize(2);
+    Hal::lcd->print("melt ice blocks to keep ");
+    Hal::lcd->setCursor(40, 220);
+    Hal::lcd->print("moving!");
+
+    Hal::lcd->setCursor(230, 225);
+    Hal::lcd->setTextSize(1);
+    Hal::lcd->setTextColor(TFT_MAGENTA);
+    Hal::lcd->print("back to start");
 }
 
 void drawEndScreen()
 {
-    M5.Lcd.clear(TFT_BLACK);
+    // back to the unscrolled panel
+    Hal::scrollVertically(0);
+    Hal::lcd->clear(TFT_BLACK);
     	
     drawFlower(20, 20, TFT_WHITE, TFT_YELLOW);	
     drawFlower(50, 20, TFT_PINK, TFT_YELLOW);	
@@ -1245,120 +773,311 @@ void drawEndScreen()
     drawFlower(sWidth - 50, 20, TFT_PINK, TFT_YELLOW);	
     drawFlower(sWidth - 20, 50, TFT_MAGENTA, TFT_YELLOW);
 
-    M5.Lcd.setCursor(sWidth / 5, sHeight / 3 - 20);
-    M5.Lcd.setTextColor(TFT_WHITE);
-    M5.Lcd.setTextSize(3);
-    M5.Lcd.println("You did it!");
+    Hal::lcd->setCursor(sWidth / 5, sHeight / 3 - 20);
+    Hal::lcd->setTextColor(TFT_WHITE);
+    Hal::lcd->setTextSize(3);
+    Hal::lcd->println("You did it!");
 
-    M5.Lcd.setCursor(sWidth / 5, sHeight / 2 - 20);
-    M5.Lcd.setTextSize(2);
+    Hal::lcd->setCursor(sWidth / 5, sHeight / 2 - 20);
+    Hal::lcd->setTextSize(2);
     unsigned long totalTime = (mazeEndTime - mazeStartTime) / 1000;
     int minutes = totalTime / 60;
     int seconds = totalTime % 60;
-    String timeTaken = "Time Taken: " + (String)minutes + ":";
-    if (seconds < 10)
-        timeTaken += "0";
-    timeTaken += (String)seconds;
-    M5.Lcd.println(timeTaken);
-
-    M5.Lcd.setCursor(sWidth / 5 + 15, (sHeight / 2) + 10);
-    String mapLevel = "Level: ";
-    if (mazeMap == EASY) mapLevel += "Easy";
-    else if (mazeMap == MEDIUM) mapLevel += "Medium";
-    else if (mazeMap == HARD) mapLevel += "Hard";
-    else if (mazeMap == EXTREME) mapLevel += "Extreme";
-    M5.Lcd.println(mapLevel);
-
-    M5.Lcd.setCursor(sWidth / 5 + 15, (sHeight / 2) + 40);
-    String speedLevel = "Speed: ";
-    if (mazeSpeed == EASY) speedLevel += "Easy";
-    else if (mazeSpeed == MEDIUM) speedLevel += "Medium";
-    else if (mazeSpeed == HARD) speedLevel += "Hard";
-    else if (mazeSpeed == EXTREME) speedLevel += "Extreme";
-    M5.Lcd.println(speedLevel);
-
-    M5.Lcd.setCursor(130, 220);
-    M5.Lcd.setTextColor(TFT_MAGENTA);
-    M5.Lcd.print("Exit");
+    char timeTaken[32];
+    snprintf(timeTaken, sizeof(timeTaken), "Time Taken: %d:%02d", minutes, seconds);
+    Hal::lcd->println(timeTaken);
+
+    Hal::lcd->setCursor(sWidth / 5 + 15, (sHeight / 2) + 10);
+    char mapLevel[32];
+    snprintf(mapLevel, sizeof(mapLevel), "Level: %s", levelName(mazeMap));
+    Hal::lcd->println(mapLevel);
+
+    Hal::lcd->setCursor(sWidth / 5 + 15, (sHeight / 2) + 40);
+    char speedLevel[32];
+    snprintf(speedLevel, sizeof(speedLevel), "Speed: %s", levelName(mazeSpeed));
+    Hal::lcd->println(speedLevel);
+
+    Hal::lcd->setCursor(130, 220);
+    Hal::lcd->setTextColor(TFT_MAGENTA);
+    Hal::lcd->print("Exit");
 }
 void drawFlower(int xCenter, int yCenter, uint32_t petalColor, uint32_t centerColor)
 {
-    M5.Lcd.fillCircle(xCenter, yCenter - 5, 3, petalColor);
-    M5.Lcd.fillCircle(xCenter + 3, yCenter + 5, 3, petalColor);
-    M5.Lcd.fillCircle(xCenter + 5, yCenter - 2, 3, petalColor);
-    M5.Lcd.fillCircle(xCenter - 5, yCenter - 2, 3, petalColor);
-    M5.Lcd.fillCircle(xCenter - 3, yCenter + 5, 3, petalColor);
-    M5.Lcd.fillCircle(xCenter, yCenter, 2, centerColor);
+    SpriteCache::draw(renderFlower, xCenter, yCenter, petalColor, centerColor);
 }
 
 void drawFlowerBud(int xCenter, int yCenter, uint32_t color)
 {
-    M5.Lcd.fillCircle(xCenter, yCenter, 8, TFT_DARKGREEN);
-    M5.Lcd.fillEllipse(xCenter, yCenter - 3, 2, 4, color);
-    M5.Lcd.fillEllipse(xCenter, yCenter + 3, 2, 4, color);
-    M5.Lcd.fillEllipse(xCenter + 3, yCenter, 4, 2, color);
-    M5.Lcd.fillEllipse(xCenter - 3, yCenter, 4, 2, color);
+    SpriteCache::draw(renderFlowerBud, xCenter, yCenter, color);
 }
 
 void drawIceBlock(int xCenter, int yCenter)
+{
+    SpriteCache::draw(renderIceBlock, xCenter, yCenter);
+}
+
+void drawHat(int xCenter, int yCenter)
+{
+    SpriteCache::draw(renderHat, xCenter, yCenter);
+}
+
+////////////////////////////////////////////////////////////////////
+// Glyph recipes, rendered once into the sprite cache
+////////////////////////////////////////////////////////////////////
+void renderFlower(HalDisplay &gfx, int xCenter, int yCenter, uint32_t petalColor, uint32_t centerColor)
+{
+    gfx.fillCircle(xCenter, yCenter - 5, 3, petalColor);
+    gfx.fillCircle(xCenter + 3, yCenter + 5, 3, petalColor);
+    gfx.fillCircle(xCenter + 5, yCenter - 2, 3, petalColor);
+    gfx.fillCircle(xCenter - 5, yCenter - 2, 3, petalColor);
+    gfx.fillCircle(xCenter - 3, yCenter + 5, 3, petalColor);
+    gfx.fillCircle(xCenter, yCenter, 2, centerColor);
+}
+
+void renderFlowerBud(HalDisplay &gfx, int xCenter, int yCenter, uint32_t color, uint32_t unused)
+{
+    gfx.fillCircle(xCenter, yCenter, 8, TFT_DARKGREEN);
+    gfx.fillEllipse(xCenter, yCenter - 3, 2, 4, color);
+    gfx.fillEllipse(xCenter, yCenter + 3, 2, 4, color);
+    gfx.fillEllipse(xCenter + 3, yCenter, 4, 2, color);
+    gfx.fillEllipse(xCenter - 3, yCenter, 4, 2, color);
+}
+
+void renderIceBlock(HalDisplay &gfx, int xCenter, int yCenter, uint32_t unused1, uint32_t unused2)
 {
     int width = 20;
     int height = 20;
     int topLeftCornerX = xCenter - (width / 2);
     int topRightCornerX = xCenter + (width / 2);
     int topLeftCornerY = yCenter - (height / 2);
-    int topRightCornerY = yCenter + (height / 2);
-    M5.Lcd.fillRoundRect(topLeftCornerX, topLeftCornerY, width, height, 2, TFT_CYAN);
-    M5.Lcd.fillCircle(topRightCornerX - 5, topLeftCornerY + 5, 2, TFT_WHITE);
-    M5.Lcd.fillEllipse(topRightCornerX - 5, topLeftCornerY + 12, 2, 4, TFT_WHITE);
+    gfx.fillRoundRect(topLeftCornerX, topLeftCornerY, width, height, 2, TFT_CYAN);
+    gfx.fillCircle(topRightCornerX - 5, topLeftCornerY + 5, 2, TFT_WHITE);
+    gfx.fillEllipse(topRightCornerX - 5, topLeftCornerY + 12, 2, 4, TFT_WHITE);
 }
 
-void drawHat(int xCenter, int yCenter)
+void renderHat(HalDisplay &gfx, int xCenter, int yCenter, uint32_t unused1, uint32_t unused2)
 {
-    M5.Lcd.fillCircle(xCenter, yCenter, 10, TFT_MAROON);
-    M5.Lcd.fillCircle(xCenter, yCenter, 6, TFT_ORANGE);
-    M5.Lcd.fillCircle(xCenter, yCenter, 5, TFT_MAROON);
+    gfx.fillCircle(xCenter, yCenter, 10, TFT_MAROON);
+    gfx.fillCircle(xCenter, yCenter, 6, TFT_ORANGE);
+    gfx.fillCircle(xCenter, yCenter, 5, TFT_MAROON);
 }
 
-int convertCoor(int coor)
+// Recipe for one atlas tile: half walls on the closed sides, then the floor
+void renderTile(HalDisplay &gfx, uint8_t openings, uint8_t look)
 {
-    return (coor * 40) + 20;
+    int center = floorTileLength / 2;
+    gfx.clear(floorColor);
+
+    if (!(openings & OPEN_LEFT))
+        gfx.fillRect(0, 0, halfWall, floorTileLength, wallColor);
+    if (!(openings & OPEN_RIGHT))
+        gfx.fillRect(floorTileLength - halfWall, 0, halfWall, floorTileLength, wallColor);
+    if (!(openings & OPEN_ABOVE))
+        gfx.fillRect(0, 0, floorTileLength, halfWall, wallColor);
+    if (!(openings & OPEN_BELOW))
+        gfx.fillRect(0, floorTileLength - halfWall, floorTileLength, halfWall, wallColor);
+
+    if (look == STARTTILE || look == END_LOOK)
+        gfx.fillRect(halfWall, halfWall, floorLength, floorLength, alphaBlend565(128, TFT_PURPLE, TFT_WHITE));
+    else if (look == FLOWER)
+        renderFlowerBud(gfx, center, center, TFT_WHITE, 0);
+    else if (look == ICE)
+        renderIceBlock(gfx, center, center, 0, 0);
+    else if (look == BLOOMED)
+        renderFlower(gfx, center, center, TFT_MAGENTA, TFT_YELLOW);
 }
 
-void drawTileCover()
+int tileCenterX(int col)
 {
-    int topLeftCornerX = (currentX * floorTileLength + (floorTileLength / 2)) - (floorLength / 2);
-    int topLeftCornerY = (currentY * floorTileLength + (floorTileLength / 2)) - (floorLength / 2);
-    M5.Lcd.fillRect(topLeftCornerX, topLeftCornerY, floorLength, floorLength, floorColor);
+    return Renderer::tileX(col) + floorTileLength / 2;
+}
 
-    if (mazeFloorPlan[currentY][currentX].floor == BLOOMED)
+int tileCenterY(int row)
+{
+    return Renderer::tileY(row) + floorTileLength / 2;
+}
+
+void drawTile(int col, int row)
+{
+    // the view can be wider than a small maze
+    if (col >= mazeWidth || row >= mazeHeight)
+        return;
+
+    // repaint the floor inside the walls
+    int topLeftCornerX = Renderer::tileX(col) + halfWall;
+    int topLeftCornerY = Renderer::tileY(row) + halfWall;
+    FloorType floor = tileFloor(tileAt(col, row));
+    bool endOpen = col == endX && row == endY && numFlowersBloomed >= numFlowersToBloom;
+
+    if (TileAtlas::ready())
+    {
+        // the whole tile in one blit, only the labels can't be baked in
+        TileAtlas::draw(Renderer::tileX(col), Renderer::tileY(row), tileAt(col, row) & OPEN_MASK,
+                        endOpen ? END_LOOK : (uint8_t)floor);
+        if (endOpen)
+            drawEndLabel();
+        else if (floor == STARTTILE)
+            drawStartLabel();
+    }
+    else if (endOpen)
     {
-        drawFlower(convertCoor(currentX), convertCoor(currentY), TFT_MAGENTA, TFT_YELLOW);
+        drawEndTile();
     }
-    else if (mazeFloorPlan[currentY][currentX].floor == STARTTILE)
+    else if (floor == STARTTILE)
     {
         drawStartTile();
     }
+    else
+    {
+        Hal::lcd->fillRect(topLeftCornerX, topLeftCornerY, floorLength, floorLength, floorColor);
+
+        if (floor == FLOWER)
+        {
+            drawFlowerBud(tileCenterX(col), tileCenterY(row), TFT_WHITE);
+        }
+        else if (floor == ICE)
+        {
+            drawIceBlock(tileCenterX(col), tileCenterY(row));
+        }
+        else if (floor == BLOOMED)
+        {
+            drawFlower(tileCenterX(col), tileCenterY(row), TFT_MAGENTA, TFT_YELLOW);
+        }
+    }
+
+    // the hat sits on top of whatever the tile shows
+    if (col == hat.x && row == hat.y)
+    {
+        drawHat(tileCenterX(col), tileCenterY(row));
+        if (hintsOn)
+            drawHint(col, row);
+    }
+}
+
+void drawHint(int col, int row)
+{
+    // a bar along the side of the tile to leave by
+    uint8_t way = HintField::hint(col, row, numFlowersBloomed >= numFlowersToBloom);
+    int left = Renderer::tileX(col) + halfWall;
+    int top = Renderer::tileY(row) + halfWall;
+    int middle = (floorLength - 10) / 2;
+
+    if (way == OPEN_LEFT)
+        Hal::lcd->fillRect(left, top + middle, 3, 10, hintColor);
+    else if (way == OPEN_RIGHT)
+        Hal::lcd->fillRect(left + floorLength - 3, top + middle, 3, 10, hintColor);
+    else if (way == OPEN_ABOVE)
+        Hal::lcd->fillRect(left + middle, top, 10, 3, hintColor);
+    else if (way == OPEN_BELOW)
+        Hal::lcd->fillRect(left + middle, top + floorLength - 3, 10, 3, hintColor);
+}
+
+void toggleHints()
+{
+    hintsOn = !hintsOn;
+    if (screenState == MAZE)
+        Renderer::markDirty(currentX, currentY);
+}
+
+void moveHat(int dx, int dy)
+{
+    // repaint the tile the hat leaves and the tile it moves onto
+    Renderer::markDirty(currentX, currentY);
+
+    hat.x = hat.x + dx;
+    hat.y = hat.y + dy;
+    // update the current tile
+    currentX += dx;
+    currentY += dy;
+
+    Renderer::markDirty(currentX, currentY);
+    followHat();
 }
 
 void drawEndTile()
 {
-    int topLeftCornerX = (endX * floorTileLength + (floorTileLength / 2)) - (floorLength / 2);
-    int topLeftCornerY = (endY * floorTileLength + (floorTileLength / 2)) - (floorLength / 2);
-    M5.Lcd.fillRect(topLeftCornerX, topLeftCornerY, floorLength, floorLength, M5.Lcd.alphaBlend(128, TFT_PURPLE, TFT_WHITE));
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextColor(TFT_WHITE);
-    M5.Lcd.drawString("End", (endX * floorTileLength) + halfWall + 7, (endY * floorTileLength) + halfWall + 11, 1);
+    int topLeftCornerX = Renderer::tileX(endX) + halfWall;
+    int topLeftCornerY = Renderer::tileY(endY) + halfWall;
+    Hal::lcd->fillRect(topLeftCornerX, topLeftCornerY, floorLength, floorLength, alphaBlend565(128, TFT_PURPLE, TFT_WHITE));
+    drawEndLabel();
+}
+
+void drawEndLabel()
+{
+    int topLeftCornerX = Renderer::tileX(endX) + halfWall;
+    int topLeftCornerY = Renderer::tileY(endY) + halfWall;
+    Hal::lcd->setTextSize(1);
+    Hal::lcd->setTextColor(TFT_WHITE);
+    Hal::lcd->drawString("End", topLeftCornerX + 7, topLeftCornerY + 11, 1);
 }
 
 void drawStartTile()
 {
-    int topLeftCornerX = (startX * floorTileLength + (floorTileLength / 2)) - (floorLength / 2);
-    int topLeftCornerY = (startY * floorTileLength + (floorTileLength / 2)) - (floorLength / 2);
-    M5.Lcd.fillRect(topLeftCornerX, topLeftCornerY, floorLength, floorLength, M5.Lcd.alphaBlend(128, TFT_PURPLE, TFT_WHITE));
-    M5.Lcd.setTextColor(TFT_WHITE);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.drawString("Start", (startX * floorTileLength) + halfWall, (startY * floorTileLength) + halfWall + 11, 1);
+    int topLeftCornerX = Renderer::tileX(startX) + halfWall;
+    int topLeftCornerY = Renderer::tileY(startY) + halfWall;
+    Hal::lcd->fillRect(topLeftCornerX, topLeftCornerY, floorLength, floorLength, alphaBlend565(128, TFT_PURPLE, TFT_WHITE));
+    drawStartLabel();
+}
+
+void drawStartLabel()
+{
+    int topLeftCornerX = Renderer::tileX(startX) + halfWall;
+    int topLeftCornerY = Renderer::tileY(startY) + halfWall;
+    Hal::lcd->setTextColor(TFT_WHITE);
+    Hal::lcd->setTextSize(1);
+    Hal::lcd->drawString("Start", topLeftCornerX, topLeftCornerY + 11, 1);
+}
+
+void selectLevel(MazeLevel level)
+{
+    mazeSpeed = level;
+    mazeMap = level;
+}
+
+void startMaze()
+{
+    initMazeVariables();
+    drawMaze();
+    screenState = MAZE;
+}
+
+ScreenState currentScreenState()
+{
+    return screenState;
+}
+
+const char *levelName(MazeLevel level)
+{
+    if (level == EASY) return "Easy";
+    else if (level == MEDIUM) return "Medium";
+    else if (level == HARD) return "Hard";
+    else if (level == EXTREME) return "Extreme";
+    return "";
+}
+
+#ifdef ARDUINO
+void queueTouch(EventHandler handler, Event &e)
+{
+    if (pendingTouchCount < (int)(sizeof(pendingTouches) / sizeof(pendingTouches[0])))
+        pendingTouches[pendingTouchCount++] = {handler, e};
+}
+
+void queueTap(Event &e)
+{
+    queueTouch(onTap, e);
+}
+
+void queueDoubleTap(Event &e)
+{
+    queueTouch(onDoubleTap, e);
+}
+
+// Runs the touch events of this Hal::update(), once the bus is free again
+void handleTouches()
+{
+    for (int i = 0; i < pendingTouchCount; i++)
+        pendingTouches[i].handler(pendingTouches[i].event);
+    pendingTouchCount = 0;
 }
 
 void onTap(Event &e)
@@ -1369,33 +1088,26 @@ void onTap(Event &e)
     {
         if (b.instanceIndex() == 4)
         {
-            mazeSpeed = EASY;
-            mazeMap = EASY;
+            selectLevel(EASY);
         }
         if (b.instanceIndex() == 5)
         {
-            mazeSpeed = MEDIUM;
-            mazeMap = MEDIUM;
+            selectLevel(MEDIUM);
         }
         if (b.instanceIndex() == 6)
         {
-            mazeSpeed = HARD;
-            mazeMap = HARD;
+            selectLevel(HARD);
         }
         if (b.instanceIndex() == 7)
         {
-            mazeSpeed = EXTREME;
-            mazeMap = EXTREME;
+            selectLevel(EXTREME);
         }
 
         drawLevelButtons();
 
         if (b.instanceIndex() == 8) {
             // start button
-            initMazeVariables();
-            drawMaze();
-            drawHat(convertCoor(hat.x), convertCoor(hat.y));
-            screenState = MAZE;
+            startMaze();
             Serial.println(timerDelayMs);
         }
         if (b.instanceIndex() == 9) {
@@ -1422,24 +1134,29 @@ void onDoubleTap(Event& e) {
         screenState = START;
         
     }
+    else if (screenState == MAZE) {
+        // show or hide the way to go
+        toggleHints();
+    }
 }
+#endif
 
 void drawSensorScreen(){
-     M5.Lcd.clear(TFT_BLACK);
+     Hal::lcd->clear(TFT_BLACK);
 
-    M5.Lcd.setCursor(sWidth / 5, sHeight / 3);
-    M5.Lcd.setTextColor(TFT_CYAN);
-    M5.Lcd.setTextSize(3);
-    M5.Lcd.println("uh-oh...");
+    Hal::lcd->setCursor(sWidth / 5, sHeight / 3);
+    Hal::lcd->setTextColor(TFT_CYAN);
+    Hal::lcd->setTextSize(3);
+    Hal::lcd->println("uh-oh...");
 
-    M5.Lcd.setCursor((sWidth / 5)- 20, sHeight / 2);
-    M5.Lcd.setTextColor(TFT_WHITE);
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.print("seems like ur missing");
-    M5.Lcd.setCursor((sWidth / 5)- 20,(sHeight / 2)+20);
-    M5.Lcd.print("a sensor or two :(");
+    Hal::lcd->setCursor((sWidth / 5)- 20, sHeight / 2);
+    Hal::lcd->setTextColor(TFT_WHITE);
+    Hal::lcd->setTextSize(2);
+    Hal::lcd->print("seems like ur missing");
+    Hal::lcd->setCursor((sWidth / 5)- 20,(sHeight / 2)+20);
+    Hal::lcd->print("a sensor or two :(");
 
     drawIceBlock(sWidth-43, sHeight-25);
-    M5.Lcd.fillEllipse(sWidth-20, sHeight-23, 3, 2, TFT_CYAN);
-    M5.Lcd.fillEllipse(sWidth-15, sHeight-15, 6, 2, TFT_CYAN);
+    Hal::lcd->fillEllipse(sWidth-20, sHeight-23, 3, 2, TFT_CYAN);
+    Hal::lcd->fillEllipse(sWidth-15, sHeight-15, 6, 2, TFT_CYAN);
 }
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Compresses the RGB565 weather bitmaps into palette + run-length icons.
+
+Reads the image2cpp arrays in include/EGR425_Phase1_weather_bitmap_images.h
+and writes include/WeatherIcons.h in the PackedIcon format described in
+include/PackedIcon.h. Run it again whenever the source images change:
+
+    python3 tools/encode_icons.py
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, "include", "EGR425_Phase1_weather_bitmap_images.h")
+OUTPUT = os.path.join(ROOT, "include", "WeatherIcons.h")
+
+ICON_SIZE = 100         # imgSqDim in the source header
+MAX_PALETTE = 128       # single-pixel tokens are 0x00-0x7F
+MAX_RUN = 0x7F + 2      # run tokens are 0x80-0xFF, lengths 2..129
+
+
+def read_icons(path):
+    text = open(path).read()
+    pattern = re.compile(r"const uint16_t (\w+) \[\] PROGMEM = \{(.*?)\};", re.S)
+    icons = []
+    for match in pattern.finditer(text):
+        pixels = [int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]{4}", match.group(2))]
+        if len(pixels) != ICON_SIZE * ICON_SIZE:
+            sys.exit("%s: expected %d pixels, found %d" % (match.group(1), ICON_SIZE * ICON_SIZE, len(pixels)))
+        icons.append((match.group(1), pixels))
+    return icons
+
+
+def encode(pixels):
+    # most frequent colour first so the common indices stay small
+    counts = {}
+    for color in pixels:
+        counts[color] = counts.get(color, 0) + 1
+    palette = sorted(counts, key=lambda color: (-counts[color], color))
+    if len(palette) > MAX_PALETTE:
+        sys.exit("too many colours (%d) for one icon" % len(palette))
+    index = {color: i for i, color in enumerate(palette)}
+
+    data = bytearray()
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < MAX_RUN and pixels[i + run] == pixels[i]:
+            run += 1
+        if run == 1:
+            data.append(index[pixels[i]])
+        else:
+            data.append(0x80 | (run - 2))
+            data.append(index[pixels[i]])
+        i += run
+    return palette, data
+
+
+def decode(palette, data, count):
+    pixels = []
+    i = 0
+    while len(pixels) < count:
+        token = data[i]
+        i += 1
+        if token & 0x80:
+            pixels.extend([palette[data[i]]] * ((token & 0x7F) + 2))
+            i += 1
+        else:
+            pixels.append(palette[token])
+    return pixels
+
+
+def c_array(kind, name, values, per_line, fmt):
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append("\t" + ", ".join(fmt % value for value in values[start:start + per_line]))
+    return "static const %s %s[] PROGMEM = {\n%s\n};\n" % (kind, name, ",\n".join(lines))
+
+
+def main():
+    icons = read_icons(SOURCE)
+    out = []
+    out.append("#ifndef WEATHER_ICONS_H\n#define WEATHER_ICONS_H\n\n")
+    out.append("/////////////////////////////////////////////////////////////////////////////\n")
+    out.append("// GENERATED by tools/encode_icons.py from\n")
+    out.append("// EGR425_Phase1_weather_bitmap_images.h -- do not edit by hand.\n")
+    out.append("/////////////////////////////////////////////////////////////////////////////\n\n")
+    out.append("// Includes\n#include \"PackedIcon.h\"\n#include \"WeatherIconIndex.h\"\n\n")
+
+    raw_total = 0
+    packed_total = 0
+    for name, pixels in icons:
+        palette, data = encode(pixels)
+        if decode(palette, data, len(pixels)) != pixels:
+            sys.exit("%s: round trip failed" % name)
+        raw_total += 2 * len(pixels)
+        packed_total += 2 * len(palette) + len(data)
+
+        out.append("// '%s', %d colours, %d bytes\n" % (name, len(palette), 2 * len(palette) + len(data)))
+        out.append(c_array("uint16_t", name + "Palette", palette, 12, "0x%04X"))
+        out.append(c_array("uint8_t", name + "Data", list(data), 16, "0x%02X"))
+        out.append("\n")
+
+    out.append("// Indexed by WeatherIconId\n")
+    out.append("const PackedIcon weatherIcons[WEATHER_ICON_COUNT] = {\n")
+    for name, _ in icons:
+        out.append("    {%d, %d, sizeof(%sPalette) / sizeof(uint16_t), %sPalette, %sData, sizeof(%sData)},\n"
+                   % (ICON_SIZE, ICON_SIZE, name, name, name, name))
+    out.append("};\n\n")
+    for i, (name, _) in enumerate(icons):
+        out.append("static_assert(ICON_%s == %d, \"WeatherIconId order\");\n" % (name[1:].upper(), i))
+
+    out.append("\n// Compressed icon for an OpenWeather code (e.g. \"10d\"), or NULL\n")
+    out.append("inline const PackedIcon *getWeatherIcon(const char *iconId)\n{\n")
+    out.append("    int id = weatherIconId(iconId);\n")
+    out.append("    return id == noWeatherIcon ? NULL : &weatherIcons[id];\n}\n\n#endif\n")
+
+    open(OUTPUT, "w").write("".join(out))
+    print("%d icons: %d -> %d bytes (%.1fx)" % (len(icons), raw_total, packed_total, raw_total / packed_total))
+
+
+if __name__ == "__main__":
+    main()